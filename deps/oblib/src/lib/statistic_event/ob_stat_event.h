@@ -332,6 +332,7 @@ STAT_EVENT_ADD_DEF(INDEX_BLOCK_CACHE_HIT, "index micro block cache hit", ObStatC
 STAT_EVENT_ADD_DEF(BLOCKSCAN_BLOCK_CNT, "blockscaned data micro block count", ObStatClassIds::STORAGE, "blockscaned data micro block count", 60088, true, true)
 STAT_EVENT_ADD_DEF(BLOCKSCAN_ROW_CNT, "blockscaned row count", ObStatClassIds::STORAGE, "blockscaned row count", 60089, true, true)
 STAT_EVENT_ADD_DEF(PUSHDOWN_STORAGE_FILTER_ROW_CNT, "storage filtered row count", ObStatClassIds::STORAGE, "storage filter row count", 60090, true, true)
+STAT_EVENT_ADD_DEF(MEMSTORE_HOT_ROW_CONFLICT_COUNT, "memstore hot row write conflict count", ObStatClassIds::STORAGE, "memstore hot row write conflict count", 60091, true, true)
 
 // backup & restore
 STAT_EVENT_ADD_DEF(BACKUP_IO_READ_COUNT, "backup io read count", ObStatClassIds::STORAGE, "backup io read count", 69000, true, true)
@@ -437,6 +438,8 @@ STAT_EVENT_ADD_DEF(CLOG_FILE_TOTAL_SIZE, "clog file total size", ObStatClassIds:
 STAT_EVENT_ADD_DEF(ILOG_FILE_TOTAL_SIZE, "ilog file total size", ObStatClassIds::CLOG, "ilog file total size", 80062, true, true)
 STAT_EVENT_ADD_DEF(CLOG_BATCH_SUBMITTED_COUNT, "clog batch submitted count", ObStatClassIds::CLOG, "clog batch submitted count", 80063, true, true)
 STAT_EVENT_ADD_DEF(CLOG_BATCH_COMMITTED_COUNT, "clog batch committed count", ObStatClassIds::CLOG, "clog batch committed count", 80064, true, true)
+STAT_EVENT_ADD_DEF(PALF_PREPARED_SWITCH_BLOCK_COUNT, "palf prepared switch block count", ObStatClassIds::CLOG, "palf prepared switch block count", 80065, true, true)
+STAT_EVENT_ADD_DEF(PALF_STALL_SWITCH_BLOCK_COUNT, "palf stall switch block count", ObStatClassIds::CLOG, "palf stall switch block count", 80066, true, true)
 
 // CLOG.EXTLOG 81001 ~ 90000
 STAT_EVENT_ADD_DEF(CLOG_EXTLOG_FETCH_LOG_SIZE, "external log service fetch log size", ObStatClassIds::CLOG, "external log service fetch log size", 81001, true, true)
@@ -115,6 +115,12 @@ int ObCdcFetcher::fetch_log(const ObCdcLSFetchLogReq &req,
     EVENT_ADD(CLOG_EXTLOG_FETCH_LOG_SIZE, fetch_log_size);
     ObCdcServiceMonitor::fetch_log_count(fetch_log_count);
     EVENT_ADD(CLOG_EXTLOG_FETCH_LOG_COUNT, fetch_log_count);
+
+    // failing to compress is not an error, the uncompressed log is responded
+    int tmp_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (tmp_ret = resp.compress(req.get_compressor_type()))) {
+      LOG_WARN("compress fetch log resp fail", K(tmp_ret), K(req), K(resp));
+    }
   }
 
   resp.set_err(ret);
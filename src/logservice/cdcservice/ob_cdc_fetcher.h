@@ -105,7 +105,8 @@ private:
       FetchRunTime &frt,
       bool &reach_upper_limit);
   // Fill Group Log Entry directly into resp_buf.
-  // TODO Consider compression and decryption
+  // The whole resp_buf is compressed in fetch_log() if CDC Connector requires.
+  // TODO Consider decryption
   int prefill_resp_with_group_entry_(const ObLSID &ls_id,
       const LSN &lsn,
       LogGroupEntry &log_group_entry,
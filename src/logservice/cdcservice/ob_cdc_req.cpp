@@ -246,7 +246,7 @@ OB_DEF_DESERIALIZE(ObCdcReqStartLSNByTsResp)
  *
  */
 OB_SERIALIZE_MEMBER(ObCdcLSFetchLogReq, rpc_ver_, ls_id_, start_lsn_,
-                    upper_limit_ts_, client_pid_);
+                    upper_limit_ts_, client_pid_, compressor_type_);
 OB_SERIALIZE_MEMBER(ObCdcFetchStatus,
                     is_reach_max_lsn_,
                     is_reach_upper_limit_ts_,
@@ -271,6 +271,8 @@ OB_DEF_SERIALIZE(ObCdcLSFetchLogResp)
       pos += pos_;
     }
   }
+  // append at the tail, to be compatible with the CDC Connector of old version
+  LST_DO_CODE(OB_UNIS_ENCODE, compressor_type_, raw_size_);
 
   return ret;
 }
@@ -284,6 +286,7 @@ OB_DEF_SERIALIZE_SIZE(ObCdcLSFetchLogResp)
     LST_DO_CODE(OB_UNIS_ADD_LEN, rpc_ver_, err_, debug_err_,
                 ls_id_, feedback_type_, fetch_status_, next_req_lsn_, log_num_, pos_);
     len += pos_;
+    LST_DO_CODE(OB_UNIS_ADD_LEN, compressor_type_, raw_size_);
   } else {
     tmp_ret = OB_NOT_SUPPORTED;
     EXTLOG_LOG(ERROR, "get serialize size error, version not match",
@@ -302,13 +305,21 @@ OB_DEF_DESERIALIZE(ObCdcLSFetchLogResp)
     LST_DO_CODE(OB_UNIS_DECODE, err_, debug_err_,
                 ls_id_, feedback_type_, fetch_status_, next_req_lsn_, log_num_, pos_);
 
-    if (OB_UNLIKELY(! is_valid())) {
+    if (OB_FAIL(ret)) {
+    } else if (OB_UNLIKELY(! is_valid())) {
       ret = OB_ERR_UNEXPECTED;
       EXTLOG_LOG(ERROR, "pos_ is not valid", K(ret), K(pos_));
+    } else if (OB_UNLIKELY(data_len - pos < pos_)) {
+      ret = OB_DESERIALIZE_ERROR;
+      EXTLOG_LOG(ERROR, "log buffer is truncated", K(ret), K(pos_), K(pos), K(data_len));
     } else if (pos_ > 0) {
       MEMCPY(log_entry_buf_, buf + pos, pos_);
       pos += pos_;
     }
+    // the observer of old version doesn't encode them
+    compressor_type_ = common::NONE_COMPRESSOR;
+    raw_size_ = pos_;
+    LST_DO_CODE(OB_UNIS_DECODE, compressor_type_, raw_size_);
   } else {
     ret = OB_NOT_SUPPORTED;
     EXTLOG_LOG(ERROR, "deserialize error, version not match",
@@ -325,6 +336,7 @@ void ObCdcLSFetchLogReq::reset()
   start_lsn_.reset();
   upper_limit_ts_ = 0;
   client_pid_ = 0;
+  compressor_type_ = common::NONE_COMPRESSOR;
 }
 
 ObCdcLSFetchLogReq& ObCdcLSFetchLogReq::operator=(const ObCdcLSFetchLogReq &other)
@@ -333,6 +345,7 @@ ObCdcLSFetchLogReq& ObCdcLSFetchLogReq::operator=(const ObCdcLSFetchLogReq &othe
   ls_id_ = other.ls_id_;
   start_lsn_ = other.start_lsn_;
   upper_limit_ts_ = other.upper_limit_ts_;
+  compressor_type_ = other.compressor_type_;
 
   return *this;
 }
@@ -428,11 +441,85 @@ int ObCdcLSFetchLogResp::assign(const ObCdcLSFetchLogResp &other)
     next_req_lsn_ = other.next_req_lsn_;
     log_num_ = other.log_num_;
     pos_ = other.pos_;
+    compressor_type_ = common::NONE_COMPRESSOR;
     log_entry_buf_[0] = '\0';
 
-    if (log_num_ > 0 && pos_ > 0) {
+    if (log_num_ <= 0 || pos_ <= 0) {
+      // no log
+    } else if (other.is_compressed()) {
+      ret = decompress_from_(other);
+    } else {
       (void)MEMCPY(log_entry_buf_, other.log_entry_buf_, pos_);
     }
+    raw_size_ = pos_;
+  }
+
+  return ret;
+}
+
+int ObCdcLSFetchLogResp::decompress_from_(const ObCdcLSFetchLogResp &other)
+{
+  int ret = OB_SUCCESS;
+  common::ObCompressor *compressor = NULL;
+  int64_t decompressed_size = 0;
+
+  if (OB_UNLIKELY(other.raw_size_ <= 0 || other.raw_size_ > FETCH_BUF_LEN)) {
+    ret = OB_ERR_UNEXPECTED;
+    EXTLOG_LOG(ERROR, "invalid raw size of compressed log buffer", K(ret), K(other));
+  } else if (OB_FAIL(common::ObCompressorPool::get_instance().get_compressor(
+      other.compressor_type_, compressor))) {
+    EXTLOG_LOG(ERROR, "get compressor failed", K(ret), K(other));
+  } else if (OB_FAIL(compressor->decompress(other.log_entry_buf_, other.pos_,
+      log_entry_buf_, FETCH_BUF_LEN, decompressed_size))) {
+    EXTLOG_LOG(ERROR, "decompress log buffer failed", K(ret), K(other));
+  } else if (OB_UNLIKELY(decompressed_size != other.raw_size_)) {
+    ret = OB_CHECKSUM_ERROR;
+    EXTLOG_LOG(ERROR, "decompressed size not match", K(ret), K(decompressed_size), K(other));
+  } else {
+    pos_ = decompressed_size;
+  }
+
+  return ret;
+}
+
+int ObCdcLSFetchLogResp::compress(const common::ObCompressorType compressor_type)
+{
+  int ret = OB_SUCCESS;
+  common::ObCompressor *compressor = NULL;
+  int64_t max_overflow_size = 0;
+  char *compress_buf = NULL;
+  int64_t compress_buf_len = 0;
+  int64_t compressed_size = 0;
+
+  if (! common::ObCompressorPool::need_common_compress(compressor_type)
+      || is_compressed()
+      || pos_ < COMPRESS_THRESHOLD) {
+    // skip
+  } else if (OB_FAIL(common::ObCompressorPool::get_instance().get_compressor(
+      compressor_type, compressor))) {
+    EXTLOG_LOG(WARN, "get compressor failed", K(ret), K(compressor_type));
+  } else if (OB_FAIL(compressor->get_max_overflow_size(pos_, max_overflow_size))) {
+    EXTLOG_LOG(WARN, "get max overflow size failed", K(ret), K(pos_));
+  } else if (FALSE_IT(compress_buf_len = pos_ + max_overflow_size)) {
+  } else if (OB_ISNULL(compress_buf = static_cast<char *>(
+      common::ob_malloc(compress_buf_len, "CdcFetchCmpr")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    EXTLOG_LOG(WARN, "alloc compress buffer failed", K(ret), K(compress_buf_len));
+  } else if (OB_FAIL(compressor->compress(log_entry_buf_, pos_, compress_buf,
+      compress_buf_len, compressed_size))) {
+    EXTLOG_LOG(WARN, "compress log buffer failed", K(ret), K(compressor_type), K(pos_));
+  } else if (compressed_size >= pos_) {
+    // incompressible, e.g. the log has been encrypted
+  } else {
+    MEMCPY(log_entry_buf_, compress_buf, compressed_size);
+    raw_size_ = pos_;
+    pos_ = compressed_size;
+    compressor_type_ = compressor_type;
+  }
+
+  if (NULL != compress_buf) {
+    common::ob_free(compress_buf);
+    compress_buf = NULL;
   }
 
   return ret;
@@ -449,6 +536,8 @@ void ObCdcLSFetchLogResp::reset()
   next_req_lsn_.reset();
   log_num_ = 0;
   pos_ = 0;
+  compressor_type_ = common::NONE_COMPRESSOR;
+  raw_size_ = 0;
   log_entry_buf_[0] = '\0';
 }
 
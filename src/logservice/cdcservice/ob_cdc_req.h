@@ -18,6 +18,7 @@
 #include "logservice/palf/lsn.h"                // LSN
 #include "logservice/palf/log_group_entry.h"    // LogGroupEntry
 #include "logservice/palf/log_entry.h"          // LogEntry
+#include "lib/compress/ob_compressor_pool.h"    // ObCompressorPool
 
 namespace oceanbase
 {
@@ -167,11 +168,17 @@ public:
   void set_client_pid(const uint64_t id) { client_pid_ = id; }
   uint64_t get_client_pid() const { return client_pid_; }
 
+  // The compressor which the CDC Connector wants the log buffer of response to be compressed with.
+  // The observer of old version ignores it and always responds uncompressed log.
+  void set_compressor_type(const common::ObCompressorType type) { compressor_type_ = type; }
+  common::ObCompressorType get_compressor_type() const { return compressor_type_; }
+
   TO_STRING_KV(K_(rpc_ver),
       K_(ls_id),
       K_(start_lsn),
       K_(upper_limit_ts),
-      K_(client_pid));
+      K_(client_pid),
+      K_(compressor_type));
 
   OB_UNIS_VERSION(1);
 
@@ -181,6 +188,7 @@ private:
   LSN start_lsn_;
   int64_t upper_limit_ts_;
   uint64_t client_pid_;  // Process ID.
+  common::ObCompressorType compressor_type_;
 };
 
 // Statistics for LS
@@ -321,6 +329,11 @@ public:
     return pos_ >= 0 && pos_ <= FETCH_BUF_LEN;
   }
 
+  // Compress the filled log buffer in place with 'compressor_type', it's skipped if the
+  // log buffer is smaller than COMPRESS_THRESHOLD or can't be compressed smaller.
+  int compress(const common::ObCompressorType compressor_type);
+  bool is_compressed() const { return common::ObCompressorPool::need_common_compress(compressor_type_); }
+
   TO_STRING_KV(
       K_(rpc_ver),
       K_(err),
@@ -330,11 +343,18 @@ public:
       K_(fetch_status),
       K_(next_req_lsn),
       K_(log_num),
-      K_(pos));
+      K_(pos),
+      K_(compressor_type),
+      K_(raw_size));
   OB_UNIS_VERSION(1);
 
 private:
   static const int64_t FETCH_BUF_LEN = palf::MAX_LOG_BUFFER_SIZE * 8;
+  // small responses (e.g. heartbeat of idle LS) are not worth compressing
+  static const int64_t COMPRESS_THRESHOLD = 16 * 1024L;
+
+private:
+  int decompress_from_(const ObCdcLSFetchLogResp &other);
 
 private:
   int64_t rpc_ver_;
@@ -346,6 +366,11 @@ private:
   LSN next_req_lsn_;
   int64_t log_num_;
   int64_t pos_;
+  // If the log buffer is compressed, pos_ is the compressed size and raw_size_ is the
+  // original size. The receiver decompresses it in assign(), so readers of the log buffer
+  // always see the original GroupLogEntry/LogEntry.
+  common::ObCompressorType compressor_type_;
+  int64_t raw_size_;
   char log_entry_buf_[FETCH_BUF_LEN];
 
 private:
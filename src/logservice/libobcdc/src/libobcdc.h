@@ -47,6 +47,36 @@ struct ObCDCError
 
 typedef void (* ERROR_CALLBACK) (const ObCDCError &err);
 
+/*
+ * Typed value of a column, see IObCDCInstance::get_typed_columns.
+ * It has the layout of common::ObObj of the redo log and is not converted to string:
+ * 1. obj_type_/collation_type_/scale_ are the meta of the value
+ * 2. len_ is the byte length of a string value, or the desc of a number value
+ * 3. value_ holds the value of fixed length types, or points to the bytes of string and
+ *    number values, which are valid until the record is released
+ * 4. an in row LOB value keeps the storage lob header, an out row LOB value(is_out_row_)
+ *    is the merged data without header
+ */
+struct ObCDCTypedValue
+{
+  uint64_t column_id_;
+  uint8_t obj_type_;        ///< common::ObObjType
+  uint8_t collation_type_;  ///< common::ObCollationType
+  int8_t scale_;
+  bool has_value_;          ///< false if the column is not in the record, e.g. not updated
+  bool is_null_;
+  bool is_out_row_;
+  uint32_t len_;
+  union
+  {
+    int64_t int64_;
+    uint64_t uint64_;
+    float float_;
+    double double_;
+    const char *ptr_;
+  } value_;
+};
+
 class IObCDCInstance
 {
 public:
@@ -133,6 +163,48 @@ public:
   /// @retval OB_SUCCESS      success
   /// @retval other value     fail
   virtual int get_tenant_ids(std::vector<uint64_t> &tenant_ids) = 0;
+
+  /*
+   * fetch a batch of binlog records from OB cluster
+   * Records are popped until max_count is reached, a COMMIT or HEARTBEAT record is popped,
+   * or no more record is ready, so a batch never spans transactions and the rows of a
+   * transaction can be consumed with one call when max_count is large enough.
+   * Only the first record waits for timeout_us.
+   * NB: declared last to keep the vtable layout of the existing methods.
+   *
+   * @param [out] records       array of at least max_count records, memory allocated by oblog
+   * @param [in]  max_count     max record count of the batch
+   * @param [out] count         record count of the batch, records[0, count) should be released by
+   *                            release_record even if fail
+   *
+   * @param OB_SUCCESS          success
+   * @param OB_TIMEOUT          timeout, no record is ready
+   * @param other error code    fail
+   */
+  virtual int next_records(ICDCRecord **records,
+      const int64_t max_count,
+      int64_t &count,
+      const int64_t timeout_us) = 0;
+
+  /*
+   * get the typed column values of a DML record without string conversion
+   * Only valid if config enable_typed_column_value is on, in which case the column values of
+   * ICDCRecord are not filled, see ObCDCTypedValue.
+   * NB: declared last to keep the vtable layout of the existing methods.
+   *
+   * @param [in]  record        INSERT/UPDATE/DELETE record returned by next_record or next_records
+   * @param [out] new_cols      new values indexed by column index of the table meta
+   * @param [out] old_cols      old values indexed by column index of the table meta
+   * @param [out] column_cnt    column count of new_cols and old_cols
+   *
+   * @param OB_SUCCESS          success, new_cols and old_cols are valid until the record is released
+   * @param OB_NOT_SUPPORTED    enable_typed_column_value is off
+   * @param other error code    fail
+   */
+  virtual int get_typed_columns(ICDCRecord *record,
+      const ObCDCTypedValue *&new_cols,
+      const ObCDCTypedValue *&old_cols,
+      int64_t &column_cnt) = 0;
 };
 
 class ObCDCFactory
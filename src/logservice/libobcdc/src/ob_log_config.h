@@ -235,6 +235,11 @@ public:
   // 1. storage: transaction data is stored, can support large transactions
   // 2. memory: transaction data is not stored, it means better performance, but may can not support large transactions
   DEF_STR(working_mode, OB_CLUSTER_PARAMETER, "storage", "libocdc working mode");
+  // store service of storage working mode
+  // 1. rocksdb: transaction data is stored in RocksDB
+  // 2. file: transaction data is appended to segment files, which are removed after all data in them are recycled
+  DEF_STR(store_service_type, OB_CLUSTER_PARAMETER, "rocksdb", "store service type: rocksdb|file");
+  T_DEF_INT_INFT(file_store_segment_size, OB_CLUSTER_PARAMETER, 64, 1, "segment file size of file store service[M]");
   T_DEF_INT_INFT(rocksdb_write_buffer_size, OB_CLUSTER_PARAMETER, 64, 16, "write buffer size[M]");
 
   T_DEF_INT_INFT(io_thread_num, OB_CLUSTER_PARAMETER, 4, 1, "io thread number");
@@ -288,6 +293,9 @@ public:
   DEF_STR(sql_server_blacklist, OB_CLUSTER_PARAMETER, "|", "sql server black list");
 
   T_DEF_INT_INFT(fetch_log_rpc_timeout_sec, OB_CLUSTER_PARAMETER, 15, 1, "fetch log rpc timeout in seconds");
+  // Compressor of the log in fetch log rpc response, trades observer CPU for network bandwidth.
+  // Observer of old version ignores it and responds uncompressed log.
+  DEF_STR(fetch_log_rpc_compressor, OB_CLUSTER_PARAMETER, "none", "none, lz4_1.0, zstd_1.3.8");
 
   // Upper limit of progress difference between partitions, in seconds
   T_DEF_INT_INFT(progress_limit_sec_for_dml, OB_CLUSTER_PARAMETER, 300, 1, "dml progress limit in seconds");
@@ -472,6 +480,11 @@ public:
   // 2. Backup is on by default
   T_DEF_BOOL(enable_output_hidden_primary_key, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
 
+  // Whether to output column values as typed values by IObCDCInstance::get_typed_columns
+  // 1. Off by default; if it is on, column values are not converted to string and the columns of the record are empty
+  // 2. Only supported in memory working mode
+  T_DEF_BOOL(enable_typed_column_value, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
+
   // Ignore inconsistencies in the number of HBase mode put columns or not
   // Do not skip by default
   T_DEF_BOOL(skip_hbase_mode_put_column_count_not_consistency, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
@@ -22,6 +22,7 @@
 #include "lib/utility/ob_macro_utils.h"   // OB_FAIL
 #include "lib/oblog/ob_log_module.h"      // LOG_ERROR
 #include "lib/allocator/ob_malloc.h"      // ob_malloc/ob_free
+#include "lib/compress/ob_compressor_pool.h"  // ObCompressorPool
 
 #include "ob_log_rpc.h"                   // IObLogRpc
 #include "ob_ls_worker.h"                 // IObLSWorker
@@ -245,6 +246,8 @@ int64_t FetchLogARpc::g_rpc_result_count_per_rpc_upper_limit =
 
 bool FetchLogARpc::g_print_rpc_handle_info = ObLogConfig::default_print_rpc_handle_info;
 
+ObCompressorType FetchLogARpc::g_fetch_log_compressor_type = NONE_COMPRESSOR;
+
 void FetchLogARpc::configure(const ObLogConfig &config)
 {
   int64_t rpc_result_count_per_rpc_upper_limit = config.rpc_result_count_per_rpc_upper_limit;
@@ -254,6 +257,16 @@ void FetchLogARpc::configure(const ObLogConfig &config)
   LOG_INFO("[CONFIG]", K(rpc_result_count_per_rpc_upper_limit));
   ATOMIC_STORE(&g_print_rpc_handle_info, print_rpc_handle_info);
   LOG_INFO("[CONFIG]", K(print_rpc_handle_info));
+
+  const char *fetch_log_rpc_compressor = config.fetch_log_rpc_compressor.str();
+  ObCompressorType fetch_log_compressor_type = NONE_COMPRESSOR;
+  if (OB_SUCCESS != ObCompressorPool::get_instance().get_compressor_type(fetch_log_rpc_compressor,
+      fetch_log_compressor_type)
+      || ! ObCompressorPool::need_common_compress(fetch_log_compressor_type)) {
+    fetch_log_compressor_type = NONE_COMPRESSOR;
+  }
+  ATOMIC_STORE(&g_fetch_log_compressor_type, fetch_log_compressor_type);
+  LOG_INFO("[CONFIG]", K(fetch_log_rpc_compressor), K(fetch_log_compressor_type));
 }
 
 const char *FetchLogARpc::print_rpc_stop_reason(const RpcStopReason reason)
@@ -1205,6 +1218,7 @@ int FetchLogARpc::RpcRequest::prepare(
     LOG_ERROR("invalid argument", KR(ret), K(req_start_lsn));
   } else {
     req_.set_client_pid(static_cast<uint64_t>(getpid()));
+    req_.set_compressor_type(ATOMIC_LOAD(&g_fetch_log_compressor_type));
 
     // set start lsn
     req_.set_start_lsn(req_start_lsn);
@@ -147,6 +147,8 @@ public:
   // The maximum number of results each RPC can have, and stop sending RPCs if this number is exceeded
   static int64_t g_rpc_result_count_per_rpc_upper_limit;
   static bool g_print_rpc_handle_info;
+  // Compressor which the fetch log rpc response is required to be compressed with
+  static common::ObCompressorType g_fetch_log_compressor_type;
 
   static void configure(const ObLogConfig &config);
 
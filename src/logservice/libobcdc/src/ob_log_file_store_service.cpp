@@ -0,0 +1,564 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX OBLOG
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "ob_log_file_store_service.h"
+#include "ob_log_utils.h"                   // SIZE_TO_STR
+#include "ob_log_config.h"                  // TCONF
+#include "lib/atomic/ob_atomic.h"           // ATOMIC_*
+#include "lib/utility/ob_print_utils.h"     // databuff_printf
+#include "lib/file/file_directory_utils.h"  // FileDirectoryUtils
+#include "lib/oblog/ob_log_module.h"        // LOG_*
+#include "lib/ob_errno.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace libobcdc
+{
+ObLogFileStoreService::ObLogFileStoreService()
+  : is_inited_(false),
+    path_(),
+    segment_size_(0),
+    next_cf_id_(0),
+    default_cf_(NULL)
+{
+}
+
+ObLogFileStoreService::~ObLogFileStoreService()
+{
+  destroy();
+}
+
+int ObLogFileStoreService::init(const std::string &path)
+{
+  int ret = OB_SUCCESS;
+  void *default_cf_handle = NULL;
+
+  if (OB_UNLIKELY(is_inited_)) {
+    LOG_ERROR("ObLogFileStoreService has inited twice");
+    ret = OB_INIT_TWICE;
+  } else if (OB_FAIL(init_dir_(path.c_str()))) {
+    LOG_ERROR("init_dir_ fail", K(ret));
+  } else {
+    path_ = path;
+    segment_size_ = TCONF.file_store_segment_size << 20;
+    is_inited_ = true;
+
+    if (OB_FAIL(create_column_family("default", default_cf_handle))) {
+      LOG_ERROR("create default column family fail", KR(ret));
+      is_inited_ = false;
+    } else {
+      default_cf_ = static_cast<ColumnFamily *>(default_cf_handle);
+      _LOG_INFO("ObLogFileStoreService init success, path:%s, segment_size=%ld",
+          path_.c_str(), segment_size_);
+    }
+  }
+
+  return ret;
+}
+
+void ObLogFileStoreService::destroy()
+{
+  if (is_inited_) {
+    if (NULL != default_cf_) {
+      (void)drop_column_family(default_cf_);
+      (void)destory_column_family(default_cf_);
+      default_cf_ = NULL;
+    }
+    path_.clear();
+    segment_size_ = 0;
+    next_cf_id_ = 0;
+    is_inited_ = false;
+  }
+}
+
+int ObLogFileStoreService::close()
+{
+  // values are not persisted across restart, nothing to flush
+  LOG_INFO("file store service close succ");
+  return OB_SUCCESS;
+}
+
+int ObLogFileStoreService::init_dir_(const char *dir_path)
+{
+  int ret = OB_SUCCESS;
+  const static int64_t CMD_BUF_SIZE = 1024;
+  static char cmd_buf[CMD_BUF_SIZE];
+  int64_t cmd_pos = 0;
+
+  if (OB_FAIL(common::databuff_printf(cmd_buf, CMD_BUF_SIZE, cmd_pos, "rm -rf %s", dir_path))) {
+    LOG_ERROR("databuff_printf fail", K(ret), K(cmd_buf), K(cmd_pos), K(dir_path));
+  } else {
+    (void)system(cmd_buf);
+    LOG_INFO("system succ", K(cmd_buf), K(cmd_pos), K(dir_path));
+  }
+
+  if (OB_SUCC(ret)) {
+    if (OB_FAIL(common::FileDirectoryUtils::create_full_path(dir_path))) {
+      LOG_ERROR("FileDirectoryUtils create_full_path fail", K(ret), K(dir_path));
+    } else {
+      // succ
+    }
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::put(const std::string &key, const ObSlice &value)
+{
+  return put(default_cf_, key, value);
+}
+
+int ObLogFileStoreService::put(void *cf_handle, const std::string &key, const ObSlice &value)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+  Segment *segment = NULL;
+  int64_t offset = 0;
+  SegmentArray free_segments;
+
+  if (OB_UNLIKELY(NULL == value.buf_ || value.buf_len_ <= 0)) {
+    LOG_ERROR("invalid value", K(key.c_str()), K(value.buf_len_));
+    ret = OB_INVALID_ARGUMENT;
+  } else if (OB_FAIL(get_cf_(cf_handle, cf))) {
+    LOG_ERROR("get_cf_ fail", KR(ret), K(cf_handle));
+  } else {
+    {
+      ObSpinLockGuard guard(cf->lock_);
+      if (OB_FAIL(reserve_(*cf, value.buf_len_, segment, offset, free_segments))) {
+        LOG_ERROR("reserve_ fail", KR(ret), K(key.c_str()), K(value.buf_len_));
+      }
+    }
+
+    // the write is out of lock, the value is visible only after it is indexed
+    if (OB_SUCC(ret)) {
+      if (OB_FAIL(write_(*segment, offset, value))) {
+        LOG_ERROR("write_ fail", KR(ret), K(key.c_str()), KPC(segment), K(offset));
+      }
+    }
+
+    if (NULL != segment) {
+      ObSpinLockGuard guard(cf->lock_);
+      if (OB_FAIL(ret)) {
+        dec_ref_(segment, free_segments);
+      } else {
+        // the reference of the writer is transferred to the index
+        ValueLocation &location = cf->index_[key];
+        if (NULL != location.segment_) {
+          dec_ref_(location.segment_, free_segments);
+        }
+        location = ValueLocation(segment, offset, value.buf_len_);
+      }
+    }
+
+    free_segments_(*cf, free_segments);
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::batch_write(void *cf_handle,
+    const std::vector<std::string> &keys,
+    const std::vector<ObSlice> &values)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(keys.size() != values.size())) {
+    LOG_ERROR("keys and values not match", "key_count", keys.size(), "value_count", values.size());
+    ret = OB_INVALID_ARGUMENT;
+  }
+
+  for (int64_t idx = 0; OB_SUCC(ret) && idx < keys.size(); ++idx) {
+    if (OB_FAIL(put(cf_handle, keys[idx], values[idx]))) {
+      LOG_ERROR("put fail", KR(ret), K(idx), "key", keys[idx].c_str());
+    }
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::get(const std::string &key, std::string &value)
+{
+  return get(default_cf_, key, value);
+}
+
+int ObLogFileStoreService::get(void *cf_handle, const std::string &key, std::string &value)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+  ValueLocation location;
+  SegmentArray free_segments;
+
+  if (OB_FAIL(get_cf_(cf_handle, cf))) {
+    LOG_ERROR("get_cf_ fail", KR(ret), K(cf_handle));
+  } else {
+    {
+      ObSpinLockGuard guard(cf->lock_);
+      IndexMap::const_iterator iter = cf->index_.find(key);
+      if (cf->index_.end() == iter) {
+        ret = OB_ENTRY_NOT_EXIST;
+      } else {
+        location = iter->second;
+        // hold the segment while copying out of lock
+        location.segment_->ref_cnt_++;
+      }
+    }
+
+    if (OB_ENTRY_NOT_EXIST == ret) {
+      LOG_ERROR("value not exist in file store", KR(ret), K(key.c_str()), "cf_name", cf->name_.c_str());
+    } else if (OB_SUCC(ret)) {
+      value.assign(location.segment_->buf_ + location.offset_, location.len_);
+
+      ObSpinLockGuard guard(cf->lock_);
+      dec_ref_(location.segment_, free_segments);
+    }
+
+    free_segments_(*cf, free_segments);
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::del(const std::string &key)
+{
+  return del(default_cf_, key);
+}
+
+int ObLogFileStoreService::del(void *cf_handle, const std::string &key)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+  SegmentArray free_segments;
+
+  if (OB_FAIL(get_cf_(cf_handle, cf))) {
+    LOG_ERROR("get_cf_ fail", KR(ret), K(cf_handle));
+  } else {
+    {
+      ObSpinLockGuard guard(cf->lock_);
+      IndexMap::iterator iter = cf->index_.find(key);
+      // deleting a non-exist key is not an error, same as RocksDB
+      if (cf->index_.end() != iter) {
+        dec_ref_(iter->second.segment_, free_segments);
+        cf->index_.erase(iter);
+      }
+    }
+
+    free_segments_(*cf, free_segments);
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::del_range(void *cf_handle, const std::string &begin_key, const std::string &end_key)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+  SegmentArray free_segments;
+
+  if (OB_FAIL(get_cf_(cf_handle, cf))) {
+    LOG_ERROR("get_cf_ fail", KR(ret), K(cf_handle));
+  } else {
+    {
+      ObSpinLockGuard guard(cf->lock_);
+      // [begin_key, end_key)
+      IndexMap::iterator begin_iter = cf->index_.lower_bound(begin_key);
+      IndexMap::iterator end_iter = cf->index_.lower_bound(end_key);
+
+      for (IndexMap::iterator iter = begin_iter; iter != end_iter; ++iter) {
+        dec_ref_(iter->second.segment_, free_segments);
+      }
+      cf->index_.erase(begin_iter, end_iter);
+    }
+
+    free_segments_(*cf, free_segments);
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::create_column_family(const std::string& column_family_name,
+    void *&cf_handle)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+
+  if (OB_UNLIKELY(! is_inited_)) {
+    LOG_ERROR("ObLogFileStoreService not init");
+    ret = OB_NOT_INIT;
+  } else if (OB_ISNULL(cf = new(std::nothrow) ColumnFamily())) {
+    LOG_ERROR("construct ColumnFamily fail", "column_family_name", column_family_name.c_str());
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else {
+    cf->name_ = column_family_name;
+    cf->cf_id_ = ATOMIC_FAA(&next_cf_id_, 1);
+    cf_handle = reinterpret_cast<void *>(cf);
+
+    LOG_INFO("file store create column family succ", "column_family_name", column_family_name.c_str(),
+        "cf_id", cf->cf_id_, K(cf_handle));
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::drop_column_family(void *cf_handle)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+  SegmentArray free_segments;
+
+  if (OB_FAIL(get_cf_(cf_handle, cf))) {
+    LOG_ERROR("get_cf_ fail", KR(ret), K(cf_handle));
+  } else {
+    int64_t value_count = 0;
+    {
+      ObSpinLockGuard guard(cf->lock_);
+      value_count = cf->index_.size();
+
+      for (IndexMap::iterator iter = cf->index_.begin(); iter != cf->index_.end(); ++iter) {
+        dec_ref_(iter->second.segment_, free_segments);
+      }
+      cf->index_.clear();
+
+      if (NULL != cf->active_segment_) {
+        dec_ref_(cf->active_segment_, free_segments);
+        cf->active_segment_ = NULL;
+      }
+    }
+
+    free_segments_(*cf, free_segments);
+
+    LOG_INFO("file store drop column family succ", "column_family_name", cf->name_.c_str(),
+        K(value_count), "disk_usage", cf->disk_usage_);
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::destory_column_family(void *cf_handle)
+{
+  int ret = OB_SUCCESS;
+  ColumnFamily *cf = NULL;
+
+  if (OB_FAIL(get_cf_(cf_handle, cf))) {
+    LOG_ERROR("get_cf_ fail", KR(ret), K(cf_handle));
+  } else if (OB_UNLIKELY(NULL != cf->active_segment_ || ! cf->index_.empty())) {
+    LOG_ERROR("column family should be dropped before destroy", "column_family_name", cf->name_.c_str(),
+        "value_count", cf->index_.size(), KPC(cf->active_segment_));
+    ret = OB_STATE_NOT_MATCH;
+  } else {
+    LOG_INFO("file store destroy column family succ", "column_family_name", cf->name_.c_str());
+    delete cf;
+    cf = NULL;
+  }
+
+  return ret;
+}
+
+void ObLogFileStoreService::get_mem_usage(const std::vector<uint64_t> ids,
+    const std::vector<void *> cf_handles)
+{
+  int ret = OB_SUCCESS;
+  int64_t total_value_count = 0;
+  int64_t total_disk_usage = 0;
+
+  for (int64_t idx = 0; OB_SUCC(ret) && idx < cf_handles.size(); ++idx) {
+    ColumnFamily *cf = NULL;
+
+    if (OB_FAIL(get_cf_(cf_handles[idx], cf))) {
+      LOG_ERROR("get_cf_ fail", KR(ret), K(idx));
+    } else {
+      int64_t value_count = 0;
+      const int64_t disk_usage = ATOMIC_LOAD(&cf->disk_usage_);
+      {
+        ObSpinLockGuard guard(cf->lock_);
+        value_count = cf->index_.size();
+      }
+      total_value_count += value_count;
+      total_disk_usage += disk_usage;
+
+      LOG_INFO("[FILE_STORE] [USAGE]", "tenant_id", ids[idx], K(value_count),
+          "disk_usage", SIZE_TO_STR(disk_usage));
+    }
+  } // for
+
+  LOG_INFO("[FILE_STORE] [TOTAL_USAGE]", K(total_value_count),
+      "disk_usage", SIZE_TO_STR(total_disk_usage));
+}
+
+int ObLogFileStoreService::get_cf_(void *cf_handle, ColumnFamily *&cf)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(! is_inited_)) {
+    LOG_ERROR("ObLogFileStoreService not init");
+    ret = OB_NOT_INIT;
+  } else if (OB_ISNULL(cf = static_cast<ColumnFamily *>(cf_handle))) {
+    LOG_ERROR("column_family_handle is NULL");
+    ret = OB_INVALID_ARGUMENT;
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::reserve_(ColumnFamily &cf,
+    const int64_t len,
+    Segment *&segment,
+    int64_t &offset,
+    SegmentArray &free_segments)
+{
+  int ret = OB_SUCCESS;
+  Segment *active_segment = cf.active_segment_;
+
+  // seal the active segment if it's full
+  if (NULL != active_segment && active_segment->write_pos_ + len > active_segment->size_) {
+    dec_ref_(active_segment, free_segments);
+    cf.active_segment_ = NULL;
+    active_segment = NULL;
+  }
+
+  if (NULL == active_segment) {
+    if (OB_FAIL(create_segment_(cf, len, active_segment))) {
+      LOG_ERROR("create_segment_ fail", KR(ret), "cf_name", cf.name_.c_str(), K(len));
+    } else {
+      cf.active_segment_ = active_segment;
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    segment = active_segment;
+    offset = active_segment->write_pos_;
+    active_segment->write_pos_ += len;
+    active_segment->ref_cnt_++;
+  }
+
+  return ret;
+}
+
+int ObLogFileStoreService::create_segment_(ColumnFamily &cf, const int64_t len, Segment *&segment)
+{
+  int ret = OB_SUCCESS;
+  // a value larger than segment size owns a segment
+  const int64_t size = std::max(segment_size_, len);
+  std::string path;
+  void *buf = MAP_FAILED;
+  int fd = -1;
+  get_segment_path_(cf.cf_id_, cf.next_seg_id_, path);
+
+  if (OB_UNLIKELY(0 > (fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644)))) {
+    LOG_ERROR("open segment file fail", K(errno), "path", path.c_str());
+    ret = OB_IO_ERROR;
+  } else if (OB_UNLIKELY(0 != ::ftruncate(fd, size))) {
+    LOG_ERROR("ftruncate segment file fail", K(errno), "path", path.c_str(), K(size));
+    ret = OB_IO_ERROR;
+  } else if (OB_UNLIKELY(MAP_FAILED == (buf = ::mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0)))) {
+    LOG_ERROR("mmap segment file fail", K(errno), "path", path.c_str(), K(size));
+    ret = OB_IO_ERROR;
+  } else if (OB_ISNULL(segment = new(std::nothrow) Segment())) {
+    LOG_ERROR("construct Segment fail", "path", path.c_str());
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else {
+    segment->fd_ = fd;
+    segment->buf_ = static_cast<const char *>(buf);
+    segment->size_ = size;
+    segment->seg_id_ = cf.next_seg_id_++;
+    // held by the column family until sealed
+    segment->ref_cnt_ = 1;
+    ATOMIC_AAF(&cf.disk_usage_, size);
+
+    LOG_DEBUG("create segment succ", "path", path.c_str(), KPC(segment));
+  }
+
+  if (OB_FAIL(ret)) {
+    if (MAP_FAILED != buf) {
+      (void)::munmap(buf, size);
+    }
+    if (0 <= fd) {
+      (void)::close(fd);
+      (void)::unlink(path.c_str());
+    }
+  }
+
+  return ret;
+}
+
+void ObLogFileStoreService::dec_ref_(Segment *segment, SegmentArray &free_segments)
+{
+  if (NULL != segment && 0 == --segment->ref_cnt_) {
+    free_segments.push_back(segment);
+  }
+}
+
+// called out of lock, no one could reference the segments any more
+void ObLogFileStoreService::free_segments_(ColumnFamily &cf, SegmentArray &free_segments)
+{
+  std::string path;
+
+  for (int64_t idx = 0; idx < free_segments.size(); ++idx) {
+    Segment *segment = free_segments[idx];
+    path.clear();
+    get_segment_path_(cf.cf_id_, segment->seg_id_, path);
+
+    (void)::munmap(const_cast<char *>(segment->buf_), segment->size_);
+    (void)::close(segment->fd_);
+    if (OB_UNLIKELY(0 != ::unlink(path.c_str()))) {
+      LOG_WARN("unlink segment file fail", K(errno), "path", path.c_str());
+    }
+    ATOMIC_SAF(&cf.disk_usage_, segment->size_);
+
+    LOG_DEBUG("free segment succ", "path", path.c_str(), KPC(segment));
+    delete segment;
+    segment = NULL;
+  }
+  free_segments.clear();
+}
+
+void ObLogFileStoreService::get_segment_path_(const int64_t cf_id,
+    const int64_t seg_id,
+    std::string &path) const
+{
+  path.append(path_);
+  path.append("/");
+  path.append(std::to_string(cf_id));
+  path.append("_");
+  path.append(std::to_string(seg_id));
+  path.append(".seg");
+}
+
+int ObLogFileStoreService::write_(const Segment &segment, const int64_t offset, const ObSlice &value)
+{
+  int ret = OB_SUCCESS;
+  int64_t write_len = 0;
+
+  while (OB_SUCC(ret) && write_len < value.buf_len_) {
+    const ssize_t len = ::pwrite(segment.fd_, value.buf_ + write_len, value.buf_len_ - write_len,
+        offset + write_len);
+
+    if (len > 0) {
+      write_len += len;
+    } else if (len < 0 && EINTR == errno) {
+      // retry
+    } else {
+      LOG_ERROR("pwrite segment file fail", K(errno), K(len), K(segment), K(offset), K(write_len));
+      ret = OB_IO_ERROR;
+    }
+  }
+
+  return ret;
+}
+
+}
+}
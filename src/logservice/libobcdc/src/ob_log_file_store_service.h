@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LIBOBCDC_OB_LOG_FILE_STORE_SERVICE_H_
+#define OCEANBASE_LIBOBCDC_OB_LOG_FILE_STORE_SERVICE_H_
+
+#include <map>
+#include "ob_log_store_service.h"
+#include "lib/lock/ob_spin_lock.h"          // ObSpinLock
+#include "lib/utility/ob_print_utils.h"    // TO_STRING_KV
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+// ObLogFileStoreService spills the redo data to append-only segment files instead of RocksDB.
+//
+// The redo data stored by libobcdc is written once, read once by ObLogReader and deleted after
+// the transaction is output, so the compaction of LSM tree is pure overhead here:
+// 1. Each column family(one per tenant) appends values into its active segment with pwrite,
+//    a segment is sealed when it's full and a new one is created;
+// 2. An in-memory ordered index maps key to the (segment, offset, length) of the value, values
+//    are read through a read-only mapping of the segment file;
+// 3. Each segment counts the live values in it, a sealed segment is unlinked as a whole
+//    once all the values in it have been deleted.
+class ObLogFileStoreService : public IObStoreService
+{
+public:
+  ObLogFileStoreService();
+  virtual ~ObLogFileStoreService();
+  int init(const std::string &path);
+  void destroy();
+
+public:
+  virtual int put(const std::string &key, const ObSlice &value);
+  virtual int put(void *cf_handle, const std::string &key, const ObSlice &value);
+
+  virtual int batch_write(void *cf_handle, const std::vector<std::string> &keys, const std::vector<ObSlice> &values);
+
+  virtual int get(const std::string &key, std::string &value);
+  virtual int get(void *cf_handle, const std::string &key, std::string &value);
+
+  virtual int del(const std::string &key);
+  virtual int del(void *cf_handle, const std::string &key);
+  virtual int del_range(void *cf_handle, const std::string &begin_key, const std::string &end_key);
+
+  virtual int create_column_family(const std::string& column_family_name,
+      void *&cf_handle);
+  virtual int drop_column_family(void *cf_handle);
+  virtual int destory_column_family(void *cf_handle);
+
+  virtual int close();
+  virtual void get_mem_usage(const std::vector<uint64_t> ids,
+      const std::vector<void *> cf_handles);
+
+private:
+  struct Segment
+  {
+    Segment() : fd_(-1), buf_(NULL), size_(0), write_pos_(0), ref_cnt_(0), seg_id_(0) {}
+
+    TO_STRING_KV(K_(fd), KP_(buf), K_(size), K_(write_pos), K_(ref_cnt), K_(seg_id));
+
+    int fd_;
+    // read-only shared mapping of the whole segment file
+    const char *buf_;
+    int64_t size_;
+    int64_t write_pos_;
+    // live values + in-flight reads and writes + 1 if it's the active segment
+    int64_t ref_cnt_;
+    int64_t seg_id_;
+  };
+
+  struct ValueLocation
+  {
+    ValueLocation() : segment_(NULL), offset_(0), len_(0) {}
+    ValueLocation(Segment *segment, const int64_t offset, const int64_t len)
+      : segment_(segment), offset_(offset), len_(len) {}
+
+    Segment *segment_;
+    int64_t offset_;
+    int64_t len_;
+  };
+
+  typedef std::map<std::string, ValueLocation> IndexMap;
+  typedef std::vector<Segment *> SegmentArray;
+
+  struct ColumnFamily
+  {
+    ColumnFamily() : lock_(), name_(), cf_id_(0), index_(), active_segment_(NULL),
+                     next_seg_id_(0), disk_usage_(0) {}
+
+    common::ObSpinLock lock_;
+    std::string name_;
+    int64_t cf_id_;
+    IndexMap index_;
+    Segment *active_segment_;
+    int64_t next_seg_id_;
+    // total size of segment files not unlinked
+    int64_t disk_usage_;
+  };
+
+private:
+  int init_dir_(const char *dir_path);
+  int get_cf_(void *cf_handle, ColumnFamily *&cf);
+  // reserve [offset, offset + len) in the active segment, switch to a new segment if it's full
+  int reserve_(ColumnFamily &cf, const int64_t len, Segment *&segment, int64_t &offset,
+      SegmentArray &free_segments);
+  int create_segment_(ColumnFamily &cf, const int64_t len, Segment *&segment);
+  void dec_ref_(Segment *segment, SegmentArray &free_segments);
+  void free_segments_(ColumnFamily &cf, SegmentArray &free_segments);
+  void get_segment_path_(const int64_t cf_id, const int64_t seg_id, std::string &path) const;
+  int write_(const Segment &segment, const int64_t offset, const ObSlice &value);
+
+private:
+  bool is_inited_;
+  std::string path_;
+  int64_t segment_size_;
+  int64_t next_cf_id_;
+  ColumnFamily *default_cf_;
+
+  DISALLOW_COPY_AND_ASSIGN(ObLogFileStoreService);
+};
+
+}
+}
+
+#endif
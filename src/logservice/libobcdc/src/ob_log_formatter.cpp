@@ -57,6 +57,8 @@ void ObLogFormatter::RowValue::reset()
   (void)memset(new_columns_, 0, sizeof(new_columns_));
   (void)memset(old_columns_, 0, sizeof(old_columns_));
   (void)memset(orig_default_value_, 0, sizeof(orig_default_value_));
+  (void)memset(new_col_values_, 0, sizeof(new_col_values_));
+  (void)memset(old_col_values_, 0, sizeof(old_col_values_));
   (void)memset(is_rowkey_, 0, sizeof(is_rowkey_));
   (void)memset(is_changed_, 0, sizeof(is_changed_));
 }
@@ -72,6 +74,8 @@ int ObLogFormatter::RowValue::init(const int64_t column_num, const bool contain_
     (void)memset(new_columns_, 0, column_num * sizeof(new_columns_[0]));
     (void)memset(old_columns_, 0, column_num * sizeof(old_columns_[0]));
     (void)memset(orig_default_value_, 0, column_num * sizeof(orig_default_value_[0]));
+    (void)memset(new_col_values_, 0, column_num * sizeof(new_col_values_[0]));
+    (void)memset(old_col_values_, 0, column_num * sizeof(old_col_values_[0]));
     (void)memset(is_rowkey_, 0, column_num * sizeof(is_rowkey_[0]));
     (void)memset(is_changed_, 0, column_num * sizeof(is_changed_[0]));
   }
@@ -95,6 +99,7 @@ ObLogFormatter::ObLogFormatter() : inited_(false),
                                    hbase_util_(NULL),
                                    skip_hbase_mode_put_column_count_not_consistency_(false),
                                    enable_output_hidden_primary_key_(false),
+                                   enable_typed_column_value_(false),
                                    log_entry_task_count_(0)
 
 {
@@ -118,7 +123,8 @@ int ObLogFormatter::init(const int64_t thread_num,
       const bool enable_hbase_mode,
       ObLogHbaseUtil &hbase_util,
       const bool skip_hbase_mode_put_column_count_not_consistency,
-      const bool enable_output_hidden_primary_key)
+      const bool enable_output_hidden_primary_key,
+      const bool enable_typed_column_value)
 {
   int ret = OB_SUCCESS;
 
@@ -155,10 +161,11 @@ int ObLogFormatter::init(const int64_t thread_num,
     hbase_util_ = &hbase_util;
     skip_hbase_mode_put_column_count_not_consistency_ = skip_hbase_mode_put_column_count_not_consistency;
     enable_output_hidden_primary_key_ = enable_output_hidden_primary_key;
+    enable_typed_column_value_ = enable_typed_column_value;
     log_entry_task_count_ = 0;
     inited_ = true;
     LOG_INFO("Formatter init succ", K(working_mode_), "working_mode", print_working_mode(working_mode_),
-        K(thread_num), K(queue_size));
+        K(thread_num), K(queue_size), K(enable_typed_column_value));
   }
 
   return ret;
@@ -186,6 +193,7 @@ void ObLogFormatter::destroy()
   hbase_util_ = NULL;
   skip_hbase_mode_put_column_count_not_consistency_ = false;
   enable_output_hidden_primary_key_ = false;
+  enable_typed_column_value_ = false;
   log_entry_task_count_ = 0;
 }
 
@@ -224,14 +232,19 @@ int ObLogFormatter::push(IStmtTask *stmt_task, volatile bool &stop_flag)
     LOG_ERROR("invalid arguments", K(stmt_task));
     ret = OB_INVALID_ARGUMENT;
   } else {
-    // Ensure that all stmt of ObLogEntryTask are pushed to the same queue
-    const uint64_t hash_value = ATOMIC_FAA(&round_value_, 1);
+    // Every FORMAT_STMT_BATCH_SIZE stmts of ObLogEntryTask are pushed to the same queue.
+    // The stmts may be formatted concurrently, the last formatted one links the row list in finish_format_
+    uint64_t hash_value = ATOMIC_FAA(&round_value_, 1);
     int64_t stmt_count = 0;
 
     while (OB_SUCC(ret) && NULL != stmt_task) {
       IStmtTask *next = stmt_task->get_next();
       void *push_task = static_cast<void *>(stmt_task);
 
+      if (stmt_count > 0 && 0 == stmt_count % FORMAT_STMT_BATCH_SIZE) {
+        hash_value = ATOMIC_FAA(&round_value_, 1);
+      }
+
       RETRY_FUNC(stop_flag, *(static_cast<ObMQThread *>(this)), push, push_task, hash_value, DATA_OP_TIMEOUT);
 
       if (OB_SUCC(ret)) {
@@ -776,13 +789,15 @@ int ObLogFormatter::build_row_value_(
     const int64_t column_num = tb_schema_info->get_usr_column_count();
     const uint64_t aux_lob_meta_tid = tb_schema_info->get_aux_lob_meta_tid();
     const bool is_cur_stmt_task_cb_progress = stmt_task->is_callback();
+    // typed column values are output as is, skip the conversion to string
+    ObObj2strHelper *obj2str_helper = enable_typed_column_value_ ? NULL : obj2str_helper_;
 
     if (column_num <= 0) {
       LOG_INFO("no valid column is found", "table_name", simple_table_schema->get_table_name(),
           "table_id", simple_table_schema->get_table_id());
-    } else if (! is_cur_stmt_task_cb_progress && OB_FAIL(stmt_task->parse_cols(obj2str_helper_, simple_table_schema,
+    } else if (! is_cur_stmt_task_cb_progress && OB_FAIL(stmt_task->parse_cols(obj2str_helper, simple_table_schema,
             tb_schema_info, tz_info_wrap, enable_output_hidden_primary_key_))) {
-      LOG_ERROR("stmt_task.parse_cols fail", KR(ret), K(*stmt_task), K(obj2str_helper_),
+      LOG_ERROR("stmt_task.parse_cols fail", KR(ret), K(*stmt_task), K(obj2str_helper),
           KPC(simple_table_schema), KPC(tb_schema_info),
           K(enable_output_hidden_primary_key_));
     } else if (OB_FAIL(stmt_task->get_cols(&rowkey_cols, &new_cols, &old_cols, &new_lob_ctx_cols))) {
@@ -815,6 +830,8 @@ int ObLogFormatter::build_row_value_(
       } else if (OB_FAIL(fill_orig_default_value_(rv, simple_table_schema, *tb_schema_info,
               stmt_task->get_redo_log_entry_task().get_allocator()))) {
         LOG_ERROR("fill_orig_default_value_ fail", KR(ret), K(rv), K(simple_table_schema));
+      } else if (enable_typed_column_value_ && OB_FAIL(build_typed_cols_(*rv, *stmt_task))) {
+        LOG_ERROR("build_typed_cols_ fail", KR(ret), K(column_num), KPC(stmt_task));
       } else {
         new_column_cnt = new_cols->num_;
         int64_t column_array_size = sizeof(binlogBuf) * column_num;
@@ -925,6 +942,7 @@ int ObLogFormatter::fill_normal_cols_(
               K(column_id),
               KPC(column_schema_info));
         } else if (is_new_value) {
+          rv->new_col_values_[usr_column_idx] = cv;
           if (! cv->is_out_row_) {
             rv->new_columns_[usr_column_idx] = &cv->string_value_;
           } else {
@@ -949,6 +967,7 @@ int ObLogFormatter::fill_normal_cols_(
           }
           rv->is_changed_[usr_column_idx] = true;
         } else {
+          rv->old_col_values_[usr_column_idx] = cv;
           if (! cv->is_out_row_) {
             rv->old_columns_[usr_column_idx] = &cv->string_value_;
           } else {
@@ -1027,6 +1046,7 @@ int ObLogFormatter::fill_rowkey_cols_(RowValue *rv,
         // If the primary key column has been modified, the value after the modification is used, otherwise the value before the modification is used
         if (NULL == rv->new_columns_[rowkey_index]) {
           rv->new_columns_[rowkey_index] = &(cv_node->string_value_);
+          rv->new_col_values_[rowkey_index] = cv_node;
         }
 
         rv->is_rowkey_[rowkey_index] = true;
@@ -1034,6 +1054,7 @@ int ObLogFormatter::fill_rowkey_cols_(RowValue *rv,
 
         if (rv->contain_old_column_ && NULL == rv->old_columns_[rowkey_index]) {
           rv->old_columns_[rowkey_index] = &(cv_node->string_value_);
+          rv->old_col_values_[rowkey_index] = cv_node;
         }
       }
     } // for
@@ -1142,6 +1163,49 @@ int ObLogFormatter::fill_orig_default_value_(RowValue *rv,
   return ret;
 }
 
+int ObLogFormatter::build_typed_cols_(const RowValue &rv, DmlStmtTask &stmt_task)
+{
+  int ret = OB_SUCCESS;
+  const int64_t column_num = rv.column_num_;
+  const int64_t typed_cols_size = sizeof(ObCDCTypedValue) * column_num;
+  ObCDCTypedValue *typed_new_cols =
+    static_cast<ObCDCTypedValue *>(stmt_task.get_redo_log_entry_task().alloc(typed_cols_size));
+  ObCDCTypedValue *typed_old_cols =
+    static_cast<ObCDCTypedValue *>(stmt_task.get_redo_log_entry_task().alloc(typed_cols_size));
+
+  if (OB_ISNULL(typed_new_cols) || OB_ISNULL(typed_old_cols)) {
+    LOG_ERROR("allocate memory for typed column array fail", K(typed_cols_size), K(column_num));
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else {
+    (void)memset(typed_new_cols, 0, typed_cols_size);
+    (void)memset(typed_old_cols, 0, typed_cols_size);
+
+    for (int64_t i = 0; i < column_num; i++) {
+      for (int64_t j = 0; j < 2; j++) {
+        const bool is_new_value = (0 == j);
+        const ColValue *cv = is_new_value ? rv.new_col_values_[i] : rv.old_col_values_[i];
+        const ObString *str = is_new_value ? rv.new_columns_[i] : rv.old_columns_[i];
+        ObCDCTypedValue &typed_value = is_new_value ? typed_new_cols[i] : typed_old_cols[i];
+
+        if (NULL == cv) {
+          // not in the record, e.g. not updated or a column added after the row was written
+        } else if (! cv->is_out_row_) {
+          cv->to_typed_value(typed_value);
+        } else if (NULL != str) {
+          // the value of an out row LOB is the data merged from the aux lob meta table
+          cv->to_typed_value(typed_value);
+          typed_value.len_ = static_cast<uint32_t>(str->length());
+          typed_value.value_.ptr_ = str->ptr();
+        }
+      }
+    }
+
+    stmt_task.set_typed_cols(typed_new_cols, typed_old_cols, column_num);
+  }
+
+  return ret;
+}
+
 int ObLogFormatter::set_src_category_(IBinlogRecord *br_data,
     RowValue *rv,
     const ObDmlFlag &dml_flag,
@@ -108,7 +108,8 @@ public:
       const bool enable_hbase_mode,
       ObLogHbaseUtil &hbase_util,
       const bool skip_hbase_mode_put_column_count_not_consistency,
-      const bool enable_output_hidden_primary_key);
+      const bool enable_output_hidden_primary_key,
+      const bool enable_typed_column_value);
   void destroy();
 
 private:
@@ -122,6 +123,9 @@ private:
     common::ObString *new_columns_[common::OB_MAX_COLUMN_NUMBER];
     common::ObString *old_columns_[common::OB_MAX_COLUMN_NUMBER];
     common::ObString *orig_default_value_[common::OB_MAX_COLUMN_NUMBER];
+    // column values of new_columns_/old_columns_, used to build typed column values
+    ColValue *new_col_values_[common::OB_MAX_COLUMN_NUMBER];
+    ColValue *old_col_values_[common::OB_MAX_COLUMN_NUMBER];
 
     bool is_rowkey_[common::OB_MAX_COLUMN_NUMBER];
     bool is_changed_[common::OB_MAX_COLUMN_NUMBER];
@@ -134,6 +138,9 @@ private:
   typedef share::schema::ObSimpleTableSchemaV2 TableSchemaType;
   static const int64_t DATA_OP_TIMEOUT = 1 * 1000 * 1000;
   static const int64_t PRINT_LOG_INTERVAL = 10 * 1000 * 1000;
+  // Statements of one ObLogEntryTask are dispatched to formatter threads in batches of this size,
+  // so that a redo with lots of rows of a big transaction is formatted by multiple threads
+  static const int64_t FORMAT_STMT_BATCH_SIZE = 256;
 
   void handle_non_full_columns_(DmlStmtTask &dml_stmt_task,
       const TableSchemaType &table_schema);
@@ -206,6 +213,9 @@ private:
       const TableSchemaType *simple_table_schema,
       const TableSchemaInfo &tb_schema_info,
       common::ObIAllocator &allocator);
+  // build the typed column values of the stmt from the column values in RowValue,
+  // which are not converted to string if enable_typed_column_value is on
+  int build_typed_cols_(const RowValue &rv, DmlStmtTask &stmt_task);
 
   int get_schema_(IObLogSchemaGetter *schema_getter,
       const int64_t version,
@@ -258,6 +268,7 @@ private:
   ObLogHbaseUtil             *hbase_util_;
   bool                       skip_hbase_mode_put_column_count_not_consistency_;
   bool                       enable_output_hidden_primary_key_;
+  bool                       enable_typed_column_value_;
   int64_t                    log_entry_task_count_;
 
 private:
@@ -56,6 +56,7 @@
 #include "ob_log_start_schema_matcher.h"  // ObLogStartSchemaMatcher
 #include "ob_log_tenant_mgr.h"            // IObLogTenantMgr
 #include "ob_log_rocksdb_store_service.h" // RocksDbStoreService
+#include "ob_log_file_store_service.h"    // ObLogFileStoreService
 
 #include "ob_log_trace_id.h"
 #include "share/ob_simple_mem_limit_getter.h"
@@ -152,6 +153,7 @@ ObLogInstance::ObLogInstance() :
     is_schema_split_mode_(false),
     drc_message_factory_binlog_record_type_(),
     working_mode_(WorkingMode::UNKNOWN_MODE),
+    enable_typed_column_value_(false),
     global_info_(),
     mysql_proxy_(),
     tenant_sql_proxy_(),
@@ -742,11 +744,13 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
   int64_t sys_start_schema_version = OB_INVALID_VERSION;
   const char *data_start_schema_version = TCONF.data_start_schema_version.str();
   const char *store_service_path = TCONF.store_service_path.str();
+  const char *store_service_type = TCONF.store_service_type.str();
   const char *working_mode_str = TCONF.working_mode.str();
   WorkingMode working_mode = get_working_mode(working_mode_str);
   const bool enable_ssl_client_authentication = (1 == TCONF.ssl_client_authentication);
   const bool enable_sort_by_seq_no = (1 == TCONF.enable_output_trans_order_by_sql_operation);
   const int64_t redo_dispatcher_mem_limit = TCONF.redo_dispatcher_memory_limit.get();
+  const bool enable_typed_column_value = (0 != TCONF.enable_typed_column_value);
 
   drc_message_factory_binlog_record_type_.assign(drc_message_factory_binlog_record_type_str,
       strlen(drc_message_factory_binlog_record_type_str));
@@ -754,10 +758,18 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
   if (OB_UNLIKELY(! is_working_mode_valid(working_mode))) {
     LOG_ERROR("working_mode is not valid", K(working_mode_str), "working_mode", print_working_mode(working_mode));
     ret = OB_INVALID_CONFIG;
+  } else if (OB_UNLIKELY(enable_typed_column_value && ! is_memory_working_mode(working_mode))) {
+    // typed column values refer to the redo data, which is only kept until the record is
+    // released in memory working mode
+    LOG_ERROR("enable_typed_column_value is only supported in memory working mode",
+        K(working_mode_str), K(enable_typed_column_value));
+    ret = OB_INVALID_CONFIG;
   } else {
     working_mode_ = working_mode;
+    enable_typed_column_value_ = enable_typed_column_value;
 
-    LOG_INFO("set working mode", K(working_mode_str), K(working_mode_), "working_mode", print_working_mode(working_mode_));
+    LOG_INFO("set working mode", K(working_mode_str), K(working_mode_), "working_mode", print_working_mode(working_mode_),
+        K(enable_typed_column_value));
   }
 
   if (OB_FAIL(ret)) {
@@ -819,7 +831,14 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
 
   INIT(log_entry_task_pool_, ObLogEntryTaskPool, TCONF.log_entry_task_prealloc_count);
 
-  INIT(store_service_, RocksDbStoreService, store_service_path);
+  if (0 == strcmp("file", store_service_type)) {
+    INIT(store_service_, ObLogFileStoreService, store_service_path);
+  } else if (0 == strcmp("rocksdb", store_service_type)) {
+    INIT(store_service_, RocksDbStoreService, store_service_path);
+  } else if (OB_SUCC(ret)) {
+    LOG_ERROR("store_service_type is not valid, expect rocksdb or file", K(store_service_type));
+    ret = OB_INVALID_CONFIG;
+  }
 
   INIT(br_pool_, ObLogBRPool, TCONF.binlog_record_prealloc_count);
 
@@ -927,7 +946,7 @@ int ObLogInstance::init_components_(const uint64_t start_tstamp_ns)
   INIT(formatter_, ObLogFormatter, TCONF.formatter_thread_num, DEFAULT_QUEUE_SIZE, working_mode_,
       &obj2str_helper_, br_pool_, meta_manager_, schema_getter_, storager_, err_handler,
       skip_dirty_data, enable_hbase_mode, hbase_util_, skip_hbase_mode_put_column_count_not_consistency,
-      enable_output_hidden_primary_key);
+      enable_output_hidden_primary_key, enable_typed_column_value_);
 
   INIT(lob_data_merger_, ObCDCLobDataMerger, TCONF.lob_data_merger_thread_num, DEFAULT_QUEUE_SIZE, *err_handler);
 
@@ -1098,7 +1117,11 @@ void ObLogInstance::destroy_components_()
   DESTROY(br_pool_, ObLogBRPool);
   DESTROY(storager_, ObLogStorager);
   DESTROY(reader_, ObLogReader);
-  DESTROY(store_service_, RocksDbStoreService);
+  if (NULL != dynamic_cast<ObLogFileStoreService *>(store_service_)) {
+    DESTROY(store_service_, ObLogFileStoreService);
+  } else {
+    DESTROY(store_service_, RocksDbStoreService);
+  }
 
   LOG_INFO("destroy all components end");
 }
@@ -1151,6 +1174,7 @@ void ObLogInstance::destroy()
   part_trans_task_count_ = 0;
   start_tstamp_ns_ = 0;
   is_schema_split_mode_ = false;
+  enable_typed_column_value_ = false;
 }
 
 int ObLogInstance::launch()
@@ -1387,6 +1411,49 @@ int ObLogInstance::next_record(IBinlogRecord **record,
   return ret;
 }
 
+int ObLogInstance::next_records(IBinlogRecord **records,
+    const int64_t max_count,
+    int64_t &count,
+    const int64_t timeout_us)
+{
+  int ret = OB_SUCCESS;
+  bool is_batch_end = false;
+  int64_t pop_timeout_us = timeout_us;
+  count = 0;
+
+  if (OB_UNLIKELY(! inited_)) {
+    LOG_ERROR("instance has not been initialized");
+    ret = OB_NOT_INIT;
+  } else if (OB_ISNULL(records) || OB_UNLIKELY(max_count <= 0)) {
+    LOG_ERROR("invalid argument", K(records), K(max_count));
+    ret = OB_INVALID_ARGUMENT;
+  } else {
+    while (OB_SUCC(ret) && ! is_batch_end && count < max_count) {
+      IBinlogRecord *record = NULL;
+
+      if (OB_FAIL(next_record(&record, pop_timeout_us))) {
+        // record has been popped if it is returned, hand it to caller to release
+        if (NULL != record) {
+          records[count++] = record;
+        }
+      } else {
+        const int record_type = record->recordType();
+        records[count++] = record;
+        // don't wait for the records after the first one
+        pop_timeout_us = 0;
+        is_batch_end = (ECOMMIT == record_type || HEARTBEAT == record_type);
+      }
+    }
+
+    // no more record is ready, output the records popped
+    if (OB_TIMEOUT == ret && count > 0) {
+      ret = OB_SUCCESS;
+    }
+  }
+
+  return ret;
+}
+
 int ObLogInstance::verify_ob_trace_id_(IBinlogRecord *br)
 {
   int ret = OB_SUCCESS;
@@ -1666,6 +1733,48 @@ void ObLogInstance::release_record(IBinlogRecord *record)
   }
 }
 
+int ObLogInstance::get_typed_columns(IBinlogRecord *record,
+    const ObCDCTypedValue *&new_cols,
+    const ObCDCTypedValue *&old_cols,
+    int64_t &column_cnt)
+{
+  int ret = OB_SUCCESS;
+  ObLogBR *br = NULL;
+  DmlStmtTask *dml_stmt_task = NULL;
+  new_cols = NULL;
+  old_cols = NULL;
+  column_cnt = 0;
+
+  if (OB_UNLIKELY(! inited_)) {
+    LOG_ERROR("instance has not been initialized");
+    ret = OB_NOT_INIT;
+  } else if (OB_UNLIKELY(! enable_typed_column_value_)) {
+    LOG_WARN("enable_typed_column_value is off, typed column values are not built");
+    ret = OB_NOT_SUPPORTED;
+  } else if (OB_ISNULL(record)) {
+    LOG_ERROR("invalid argument", K(record));
+    ret = OB_INVALID_ARGUMENT;
+  } else if (OB_UNLIKELY(EINSERT != record->recordType()
+      && EUPDATE != record->recordType()
+      && EDELETE != record->recordType())) {
+    LOG_ERROR("typed column values are only built for DML record",
+        "record_type", print_record_type(record->recordType()));
+    ret = OB_INVALID_ARGUMENT;
+  } else if (OB_ISNULL(br = reinterpret_cast<ObLogBR *>(record->getUserData()))) {
+    LOG_ERROR("binlog record user data is NULL", K(record));
+    ret = OB_ERR_UNEXPECTED;
+  } else if (OB_ISNULL(dml_stmt_task = static_cast<DmlStmtTask *>(br->get_stmt_task()))) {
+    LOG_ERROR("dml_stmt_task of binlog record is NULL", K(br));
+    ret = OB_ERR_UNEXPECTED;
+  } else {
+    new_cols = dml_stmt_task->get_typed_new_cols();
+    old_cols = dml_stmt_task->get_typed_old_cols();
+    column_cnt = dml_stmt_task->get_typed_column_cnt();
+  }
+
+  return ret;
+}
+
 void ObLogInstance::handle_error(const int err_no, const char *fmt, ...)
 {
   static const int64_t MAX_ERR_MSG_LEN = 1024;
@@ -136,6 +136,14 @@ public:
   virtual int launch();
   virtual void stop();
   virtual int get_tenant_ids(std::vector<uint64_t> &tenant_ids);
+  virtual int next_records(IBinlogRecord **records,
+      const int64_t max_count,
+      int64_t &count,
+      const int64_t timeout_us);
+  virtual int get_typed_columns(IBinlogRecord *record,
+      const ObCDCTypedValue *&new_cols,
+      const ObCDCTypedValue *&old_cols,
+      int64_t &column_cnt);
 
 public:
   void mark_stop_flag();
@@ -305,6 +313,8 @@ public:
   bool                      is_schema_split_mode_;
   std::string               drc_message_factory_binlog_record_type_;
   WorkingMode               working_mode_;
+  // column values are output by get_typed_columns without string conversion
+  bool                      enable_typed_column_value_;
   ObCDCGlobalInfo           global_info_;
 
   // compoments
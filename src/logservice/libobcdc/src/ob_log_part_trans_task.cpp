@@ -41,6 +41,7 @@
 #include "ob_log_factory.h"                         // ObLogStoreTaskFactory ReadLogBufFactory
 #include "ob_log_resource_collector.h"              // IObLogResourceCollector
 #include "ob_cdc_lob_data_merger.h"                 // IObCDCLobDataMerger
+#include "libobcdc.h"                               // ObCDCTypedValue
 
 #define PARSE_INT64(name, obj, val, INVALID_VALUE, check_value) \
     do { \
@@ -77,6 +78,23 @@ uint64_t IStmtTask::get_tenant_id() const
 
 ////////////////////////////////////////////////////////////////////////////////////////
 
+void ColValue::to_typed_value(ObCDCTypedValue &typed_value) const
+{
+  typed_value.column_id_ = column_id_;
+  typed_value.obj_type_ = static_cast<uint8_t>(value_.get_type());
+  typed_value.collation_type_ = static_cast<uint8_t>(value_.get_collation_type());
+  typed_value.scale_ = value_.get_scale();
+  typed_value.has_value_ = true;
+  typed_value.is_null_ = value_.is_null();
+  typed_value.is_out_row_ = is_out_row_;
+  // val_len_ shares the 4 bytes with the desc of number, and the 8 bytes of value are
+  // either a fixed length value or the pointer to string or number digits, copied as is
+  typed_value.len_ = static_cast<uint32_t>(value_.val_len_);
+  typed_value.value_.uint64_ = value_.v_.uint64_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
 MutatorRow::MutatorRow(
     common::ObIAllocator &allocator) :
     ObMemtableMutatorRow(),
@@ -1006,7 +1024,10 @@ DmlStmtTask::DmlStmtTask(
     is_callback_(0),
     log_entry_task_(log_entry_task),
     table_id_(OB_INVALID_ID),
-    row_(row)
+    row_(row),
+    typed_new_cols_(NULL),
+    typed_old_cols_(NULL),
+    typed_column_cnt_(0)
 {
   // set hash value
   IStmtTask::set_hash_value(row.rowkey_.murmurhash(host.get_tls_id().hash()));
@@ -1021,6 +1042,9 @@ void DmlStmtTask::reset()
   IStmtTask::reset();
   table_id_ = OB_INVALID_ID;
   row_.reset();
+  typed_new_cols_ = NULL;
+  typed_old_cols_ = NULL;
+  typed_column_cnt_ = 0;
 }
 
 const TenantLSID &DmlStmtTask::get_tls_id() const
@@ -31,6 +31,7 @@
 #include "ob_log_lighty_list.h"                     // LightyList
 #include "ob_log_all_ddl_operation_schema_info.h"   // ObLogAllDdlOperationSchemaInfo
 #include "ob_small_arena.h"                         // ObSmallArena
+#include "lib/allocator/ob_safe_arena.h"            // ObSafeArena
 #include "ob_log_task_pool.h"                       // TransTaskBase
 #include "ob_log_utils.h"                           // is_ddl_table
 #include "ob_log_resource_recycle_task.h"           // ObLogResourceRecycleTask
@@ -145,6 +146,8 @@ private:
 
 ////////////////////////////////////////////////////////////////////////////////////
 
+struct ObCDCTypedValue;
+
 // node of column value
 struct ColValue
 {
@@ -170,6 +173,8 @@ struct ColValue
 
   ColValue *get_next() { return next_; }
   void set_next(ColValue *next) { next_ = next; }
+  // fill typed_value with value_ without converting it to string
+  void to_typed_value(ObCDCTypedValue &typed_value) const;
 
   TO_STRING_KV(
       K_(value),
@@ -438,6 +443,19 @@ public:
   bool is_callback() const { return 1 == is_callback_; }
   void mark_callback() { is_callback_ = 1; }
 
+  // typed column values, only set if enable_typed_column_value is on
+  void set_typed_cols(const ObCDCTypedValue *new_cols,
+      const ObCDCTypedValue *old_cols,
+      const int64_t column_cnt)
+  {
+    typed_new_cols_ = new_cols;
+    typed_old_cols_ = old_cols;
+    typed_column_cnt_ = column_cnt;
+  }
+  const ObCDCTypedValue *get_typed_new_cols() const { return typed_new_cols_; }
+  const ObCDCTypedValue *get_typed_old_cols() const { return typed_old_cols_; }
+  int64_t get_typed_column_cnt() const { return typed_column_cnt_; }
+
 public:
   TO_STRING_KV("IStmtTask", static_cast<const IStmtTask &>(*this),
       "is_cb", is_callback_,
@@ -450,6 +468,9 @@ private:
   ObLogEntryTask          &log_entry_task_;
   uint64_t                table_id_;
   MutatorRow              &row_;
+  const ObCDCTypedValue   *typed_new_cols_;
+  const ObCDCTypedValue   *typed_old_cols_;
+  int64_t                 typed_column_cnt_;
 private:
   DISALLOW_COPY_AND_ASSIGN(DmlStmtTask);
 };
@@ -703,9 +724,9 @@ private:
   int64_t            formatted_stmt_num_;   // Number of statements that formatted
   int64_t            row_ref_cnt_;          // reference count
 
-  // Non-thread safe allocator
-  // used for Parser/Formatter
-  common::ObArenaAllocator arena_allocator_;          // allocator
+  // Thread safe allocator
+  // used for Parser/Formatter, the statements of one redo may be formatted by multiple formatter threads
+  common::ObSafeArena arena_allocator_;               // allocator
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObLogEntryTask);
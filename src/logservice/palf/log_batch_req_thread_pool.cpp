@@ -0,0 +1,231 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "log_batch_req_thread_pool.h"
+#include "share/ob_errno.h"                   // errno...
+#include "share/ob_thread_define.h"           // TGDefIDs
+#include "share/ob_thread_mgr.h"              // TG_START
+#include "share/rc/ob_tenant_base.h"          // mtl_malloc
+#include "log_rpc.h"                          // LogBatchReqType
+#include "log_rpc_packet.h"                   // LogRpcPacketImpl
+#include "log_req.h"                          // LogPushReq
+#include "log_request_handler.h"              // LogRequestHandler
+
+namespace oceanbase
+{
+namespace palf
+{
+int LogBatchReqTask::alloc(const int type,
+                           const char *buf,
+                           const int64_t size,
+                           LogBatchReqTask *&task)
+{
+  int ret = OB_SUCCESS;
+  void *ptr = NULL;
+  task = NULL;
+  if (OB_ISNULL(buf) || 0 >= size) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(type), KP(buf), K(size));
+  } else if (OB_ISNULL(ptr = mtl_malloc(sizeof(LogBatchReqTask) + size, "LogBatchReq"))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    PALF_LOG(WARN, "alloc LogBatchReqTask failed", K(ret), K(type), K(size));
+  } else {
+    task = static_cast<LogBatchReqTask *>(ptr);
+    task->type_ = type;
+    task->size_ = size;
+    MEMCPY(task->buf_, buf, size);
+  }
+  return ret;
+}
+
+void LogBatchReqTask::free(LogBatchReqTask *task)
+{
+  if (NULL != task) {
+    mtl_free(task);
+  }
+}
+
+LogBatchReqThreadPool::LogBatchReqThreadPool()
+    : tg_id_(-1),
+      palf_env_impl_(NULL),
+      is_inited_(false)
+{
+}
+
+LogBatchReqThreadPool::~LogBatchReqThreadPool()
+{
+  destroy();
+}
+
+int LogBatchReqThreadPool::init(PalfEnvImpl *palf_env_impl)
+{
+  int ret = OB_SUCCESS;
+  const int tg_id = lib::TGDefIDs::LogBatchReqThreadPool;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    PALF_LOG(ERROR, "LogBatchReqThreadPool has inited!!!", K(ret));
+  } else if (NULL == palf_env_impl) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(ERROR, "Invalid argument!!!", K(ret), KP(palf_env_impl));
+  } else if (OB_FAIL(TG_CREATE_TENANT(tg_id, tg_id_))) {
+    PALF_LOG(WARN, "LogBatchReqThreadPool TG_CREATE failed", K(ret));
+  } else {
+    palf_env_impl_ = palf_env_impl;
+    is_inited_ = true;
+    PALF_LOG(INFO, "LogBatchReqThreadPool init success", K(ret), K(tg_id_), KP(palf_env_impl_));
+  }
+  if (OB_FAIL(ret) && OB_INIT_TWICE != ret) {
+    destroy();
+  }
+  return ret;
+}
+
+int LogBatchReqThreadPool::start()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(ERROR, "LogBatchReqThreadPool not inited!!!", K(ret));
+  } else if (OB_FAIL(TG_SET_HANDLER_AND_START(tg_id_, *this))) {
+    PALF_LOG(ERROR, "start LogBatchReqThreadPool failed", K(ret));
+  } else {
+    PALF_LOG(INFO, "start LogBatchReqThreadPool success", K(ret), K(tg_id_));
+  }
+  return ret;
+}
+
+int LogBatchReqThreadPool::stop()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(WARN, "LogBatchReqThreadPool not inited!!!", K(ret));
+  } else {
+    TG_STOP(tg_id_);
+    PALF_LOG(INFO, "stop LogBatchReqThreadPool success", K(tg_id_));
+  }
+  return ret;
+}
+
+int LogBatchReqThreadPool::wait()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(WARN, "LogBatchReqThreadPool not inited!!!", K(ret));
+  } else {
+    TG_WAIT(tg_id_);
+    PALF_LOG(INFO, "wait LogBatchReqThreadPool success", K(tg_id_));
+  }
+  return ret;
+}
+
+void LogBatchReqThreadPool::destroy()
+{
+  stop();
+  wait();
+  is_inited_ = false;
+  if (-1 != tg_id_) {
+    MTL_UNREGISTER_THREAD_DYNAMIC(tg_id_);
+    TG_DESTROY(tg_id_);
+  }
+  tg_id_ = -1;
+  palf_env_impl_ = NULL;
+  PALF_LOG(INFO, "destroy LogBatchReqThreadPool success", K(tg_id_));
+}
+
+int LogBatchReqThreadPool::push(const int type, const char *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  LogBatchReqTask *task = NULL;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(WARN, "LogBatchReqThreadPool not inited!!!", K(ret));
+  } else if (OB_FAIL(LogBatchReqTask::alloc(type, buf, size, task))) {
+    PALF_LOG(WARN, "alloc LogBatchReqTask failed", K(ret), K(type), K(size));
+  } else if (OB_FAIL(TG_PUSH_TASK(tg_id_, task))) {
+    PALF_LOG(WARN, "push LogBatchReqTask failed", K(ret), K(type), K(size));
+    LogBatchReqTask::free(task);
+    task = NULL;
+  }
+  if (OB_FAIL(ret) && OB_INVALID_ARGUMENT != ret && IS_INIT) {
+    // the queue is full or out of memory, don't drop the message
+    ret = handle_log_batch_req(palf_env_impl_, type, buf, size);
+  }
+  return ret;
+}
+
+void LogBatchReqThreadPool::handle(void *task)
+{
+  int ret = OB_SUCCESS;
+  LogBatchReqTask *batch_req_task = reinterpret_cast<LogBatchReqTask*>(task);
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(ERROR, "LogBatchReqThreadPool not inited!!!", K(ret));
+  } else if (OB_ISNULL(batch_req_task)) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(ERROR, "Invalid argument!!!", K(ret), KP(batch_req_task));
+  } else if (OB_FAIL(handle_log_batch_req(palf_env_impl_, batch_req_task->type_,
+      batch_req_task->buf_, batch_req_task->size_))) {
+    PALF_LOG(TRACE, "handle_log_batch_req failed", K(ret), K(batch_req_task->type_));
+  }
+  LogBatchReqTask::free(batch_req_task);
+}
+
+int LogBatchReqThreadPool::get_tg_id() const
+{
+  return tg_id_;
+}
+
+template <typename ReqType>
+int __handle_log_batch_req(PalfEnvImpl *palf_env_impl, const char *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  LogRpcPacketImpl<ReqType> rpc_packet;
+  if (OB_FAIL(rpc_packet.deserialize(buf, size, pos))) {
+    PALF_LOG(WARN, "deserialize batch packet failed", K(ret), K(size));
+  } else {
+    LogRequestHandler handler(palf_env_impl);
+    ret = handler.handle_request(rpc_packet.palf_id_, rpc_packet.src_, rpc_packet.req_);
+    PALF_LOG(TRACE, "handle batch request", K(ret), K(rpc_packet));
+  }
+  return ret;
+}
+
+int LogBatchReqThreadPool::handle_log_batch_req(PalfEnvImpl *palf_env_impl,
+                                                const int type,
+                                                const char *buf,
+                                                const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(palf_env_impl) || OB_ISNULL(buf) || 0 >= size) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(type), KP(palf_env_impl), KP(buf), K(size));
+  } else {
+    switch (type) {
+      case LOG_BATCH_PUSH_REQ:
+        ret = __handle_log_batch_req<LogPushReq>(palf_env_impl, buf, size);
+        break;
+      case LOG_BATCH_PUSH_RESP:
+        ret = __handle_log_batch_req<LogPushResp>(palf_env_impl, buf, size);
+        break;
+      default:
+        ret = OB_NOT_SUPPORTED;
+        PALF_LOG(ERROR, "unknown log batch req type", K(ret), K(type));
+        break;
+    }
+  }
+  return ret;
+}
+} // end namespace palf
+} // end namespace oceanbase
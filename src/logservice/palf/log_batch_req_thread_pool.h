@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LOGSERVICE_LOG_BATCH_REQ_THREAD_POOL_
+#define OCEANBASE_LOGSERVICE_LOG_BATCH_REQ_THREAD_POOL_
+
+#include "lib/thread/thread_mgr_interface.h"
+
+namespace oceanbase
+{
+namespace palf
+{
+class PalfEnvImpl;
+
+// A sub request of the batch packet of ObBatchRpc. It owns a copy of the serialized
+// LogRpcPacketImpl, because the batch packet is released once ObBatchP returns.
+struct LogBatchReqTask
+{
+  static int alloc(const int type, const char *buf, const int64_t size, LogBatchReqTask *&task);
+  static void free(LogBatchReqTask *task);
+  int type_;
+  int64_t size_;
+  char buf_[0];
+};
+
+// The sub requests of a batch packet are dispatched to this thread pool instead of being
+// handled one by one by ObBatchP, so they are handled concurrently and a slow palf instance
+// doesn't delay the messages of the others coalesced in the same batch.
+class LogBatchReqThreadPool : public lib::TGTaskHandler
+{
+public:
+  LogBatchReqThreadPool();
+  ~LogBatchReqThreadPool();
+
+public:
+  int init(PalfEnvImpl *palf_env_impl);
+  int start();
+  int stop();
+  int wait();
+  void destroy();
+  // 'type' is LogBatchReqType, the sub request is handled in the calling thread if it
+  // can't be dispatched
+  int push(const int type, const char *buf, const int64_t size);
+  virtual void handle(void *task);
+  int get_tg_id() const;
+  static int handle_log_batch_req(PalfEnvImpl *palf_env_impl,
+                                  const int type,
+                                  const char *buf,
+                                  const int64_t size);
+
+public:
+  static constexpr int64_t THREAD_NUM = 4;
+  static constexpr int64_t MINI_MODE_THREAD_NUM = 1;
+  static constexpr int64_t MAX_LOG_BATCH_REQ_TASK_NUM = 10 * 10000;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(LogBatchReqThreadPool);
+
+private:
+  int tg_id_;
+  PalfEnvImpl *palf_env_impl_;
+  bool is_inited_;
+};
+} // end namespace palf
+} // end namespace oceanbase
+
+#endif
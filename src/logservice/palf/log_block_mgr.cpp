@@ -14,10 +14,14 @@
 #include <algorithm>                                    // std::sort
 #include <cstdio>                                       // renameat
 #include <fcntl.h>                                      // ::open
+#include <unistd.h>                                     // ::faccessat
+#include "lib/atomic/ob_atomic.h"                       // ATOMIC_*
+#include "lib/time/ob_time_utility.h"                   // ObTimeUtility
 #include "lib/lock/ob_spin_lock.h"
 #include "lib/ob_define.h"                              // some constexpr
 #include "lib/ob_errno.h"                               // OB_SUCCESS...
 #include "lib/container/ob_se_array_iterator.h"         // ObSEArrayIterator
+#include "lib/stat/ob_diagnose_info.h"                 // EVENT_INC
 #include "log_define.h"                                 // convert_sys_errno
 #include "share/ob_errno.h"                             // OB_NO_SUCH_FILE_OR_DIRECTORY
 #include "log_writer_utils.h"                           // LogWriteBuf
@@ -36,6 +40,10 @@ LogBlockMgr::LogBlockMgr() : curr_writable_handler_(),
                              max_block_id_(LOG_INVALID_BLOCK_ID),
                              log_block_pool_(NULL),
                              dir_fd_(-1),
+                             prepare_lock_(),
+                             has_prepared_block_(false),
+                             prepared_switch_cnt_(0),
+                             stall_switch_cnt_(0),
                              is_inited_(false)
 {
 }
@@ -68,6 +76,8 @@ int LogBlockMgr::init(const char *log_dir,
     MEMCPY(log_dir_, log_dir, OB_MAX_FILE_NAME_LENGTH);
     log_block_size_ = log_block_size;
     log_block_pool_ = log_block_pool;
+    // the prepared block may be left by previous LogBlockMgr of this directory
+    has_prepared_block_ = (0 == ::faccessat(dir_fd_, PREPARED_BLOCK_NAME, F_OK, 0));
     is_inited_ = true;
     PALF_LOG(INFO, "LogBlockMgr init success", K(ret), K(log_dir_), K(log_block_size));
   }
@@ -94,6 +104,9 @@ void LogBlockMgr::destroy()
   is_inited_ = false;
   dir_fd_ = -1;
   log_block_pool_ = NULL;
+  has_prepared_block_ = false;
+  prepared_switch_cnt_ = 0;
+  stall_switch_cnt_ = 0;
   curr_writable_handler_.destroy();
   curr_writable_block_id_ = LOG_INVALID_BLOCK_ID;
   log_block_size_ = LOG_INVALID_LSN_VAL;
@@ -106,6 +119,8 @@ int LogBlockMgr::switch_next_block(const block_id_t next_block_id)
 {
   int ret = OB_SUCCESS;
   char block_path[OB_MAX_FILE_NAME_LENGTH] = {'\0'};
+  const int64_t start_ts = ObTimeUtility::current_time();
+  bool use_prepared_block = false;
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
   } else if (true == is_valid_block_id(curr_writable_block_id_) && next_block_id != curr_writable_block_id_ + 1) {
@@ -113,8 +128,8 @@ int LogBlockMgr::switch_next_block(const block_id_t next_block_id)
     PALF_LOG(ERROR, "block_id is not continous, unexpected error", K(ret), K(next_block_id), K(curr_writable_block_id_));
   } else if (OB_FAIL(block_id_to_string(next_block_id, block_path, OB_MAX_FILE_NAME_LENGTH))) {
     PALF_LOG(ERROR, "block_id_to_string failed", K(ret), KPC(this), K(next_block_id));
-  } else if (OB_FAIL(log_block_pool_->create_block_at(dir_fd_, block_path, log_block_size_))) {
-    PALF_LOG(ERROR, "create_block_at failed", K(ret), KPC(this), K(next_block_id));
+  } else if (OB_FAIL(create_next_block_(block_path, use_prepared_block))) {
+    PALF_LOG(ERROR, "create_next_block_ failed", K(ret), KPC(this), K(next_block_id));
   } else if (OB_FAIL(curr_writable_handler_.switch_next_block(block_path))) {
     PALF_LOG(ERROR, "switch_next_block failed", K(ret));
   } else {
@@ -122,7 +137,55 @@ int LogBlockMgr::switch_next_block(const block_id_t next_block_id)
     ObSpinLockGuard guard(block_id_cache_lock_);
     // NB: just only set 'max_block_id_' is continous with 'prev_block_id'.
     max_block_id_ = next_block_id + 1;
-    PALF_LOG(INFO, "switch_next_block success", K(curr_writable_handler_), K(next_block_id));
+    PALF_LOG(INFO, "switch_next_block success", K(curr_writable_handler_), K(next_block_id),
+        K(use_prepared_block), "cost_ts", ObTimeUtility::current_time() - start_ts,
+        K_(prepared_switch_cnt), K_(stall_switch_cnt));
+  }
+  return ret;
+}
+
+int LogBlockMgr::prepare_next_block()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (ATOMIC_LOAD(&has_prepared_block_)) {
+    // already prepared
+  } else if (OB_FAIL(prepare_lock_.trylock())) {
+    // switching block, retry later
+    ret = OB_SUCCESS;
+  } else {
+    if (has_prepared_block_) {
+    } else if (OB_FAIL(log_block_pool_->create_block_at(dir_fd_, PREPARED_BLOCK_NAME, log_block_size_))) {
+      PALF_LOG(WARN, "create_block_at failed", K(ret), KPC(this));
+    } else {
+      ATOMIC_STORE(&has_prepared_block_, true);
+      PALF_LOG(INFO, "prepare_next_block success", KPC(this));
+    }
+    prepare_lock_.unlock();
+  }
+  return ret;
+}
+
+int LogBlockMgr::create_next_block_(const char *block_path, bool &use_prepared_block)
+{
+  int ret = OB_SUCCESS;
+  use_prepared_block = false;
+  if (OB_SUCCESS == prepare_lock_.trylock()) {
+    if (has_prepared_block_ && OB_SUCC(do_rename_and_fsync_(PREPARED_BLOCK_NAME, block_path))) {
+      ATOMIC_STORE(&has_prepared_block_, false);
+      use_prepared_block = true;
+    }
+    prepare_lock_.unlock();
+  }
+  if (use_prepared_block) {
+    prepared_switch_cnt_++;
+    EVENT_INC(PALF_PREPARED_SWITCH_BLOCK_COUNT);
+  } else if (OB_FAIL(log_block_pool_->create_block_at(dir_fd_, block_path, log_block_size_))) {
+    PALF_LOG(ERROR, "create_block_at failed", K(ret), KPC(this), K(block_path));
+  } else {
+    stall_switch_cnt_++;
+    EVENT_INC(PALF_STALL_SWITCH_BLOCK_COUNT);
   }
   return ret;
 }
@@ -15,6 +15,7 @@
 
 #include "lib/hash/ob_hashmap.h"          // ObHashMap
 #include "lib/container/ob_se_array.h"    // ObSEArray
+#include "lib/atomic/ob_atomic.h"         // ATOMIC_LOAD
 #include "lib/lock/ob_spin_lock.h"
 #include "lib/ob_define.h"
 #include "log_define.h"
@@ -42,8 +43,18 @@ public:
 
   void destroy();
 
+  // @brief switch to 'next_block_id', the prepared block is used if exists, otherwise,
+  // create it from log block pool synchronously(counted as a stall).
   int switch_next_block(const block_id_t next_block_id);
 
+  // @brief move a block from log block pool into log directory in advance, which is named
+  // as 'PREPARED_BLOCK_NAME'. Called by background thread, so that 'switch_next_block'
+  // only needs to rename it in the same directory.
+  // NB: the prepared block is a tmp file, it will be returned to log block pool when
+  // restarting or removing the directory.
+  int prepare_next_block();
+  bool has_prepared_block() const { return ATOMIC_LOAD(&has_prepared_block_); }
+
   // @brief this function used to write data at specified offset.
   // Swithing block when failed to write or reach block size.
   int pwrite(const block_id_t block_id,
@@ -71,7 +82,8 @@ public:
                          const offset_t offset);
   const char *get_log_dir() const { return log_dir_; }
 
-  TO_STRING_KV(K_(log_dir), K_(dir_fd), K_(min_block_id), K_(max_block_id), K_(curr_writable_block_id));
+  TO_STRING_KV(K_(log_dir), K_(dir_fd), K_(min_block_id), K_(max_block_id), K_(curr_writable_block_id),
+               K_(has_prepared_block), K_(prepared_switch_cnt), K_(stall_switch_cnt));
 
 private:
   // @brief this function used to rebuild 'blocks_'
@@ -87,7 +99,9 @@ private:
   int do_rename_and_fsync_(const char *block_path, const char *tmp_block_path);
   bool empty_() const;
   int try_recovery_last_block_(const char *log_dir);
+  int create_next_block_(const char *block_path, bool &use_prepared_block);
   const int64_t SLEEP_TS_US = 1 * 1000;
+  static constexpr const char *PREPARED_BLOCK_NAME = "next.tmp";
 
 private:
   char log_dir_[OB_MAX_FILE_NAME_LENGTH];
@@ -115,6 +129,12 @@ private:
   mutable block_id_t max_block_id_;
   ILogBlockPool *log_block_pool_;
   int dir_fd_;
+  // protect 'has_prepared_block_', 'switch_next_block' never waits for it.
+  ObSpinLock prepare_lock_;
+  bool has_prepared_block_;
+  // statistics of 'switch_next_block'
+  int64_t prepared_switch_cnt_;
+  int64_t stall_switch_cnt_;
   bool is_inited_;
 };
 } // end of logservice
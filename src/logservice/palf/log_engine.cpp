@@ -542,6 +542,17 @@ int LogEngine::truncate_prefix_blocks(const LSN &lsn)
   return ret;
 }
 
+int LogEngine::prepare_next_block()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(log_storage_.prepare_next_block())) {
+    PALF_LOG(WARN, "LogStorage prepare_next_block failed", K(ret), K_(palf_id));
+  }
+  return ret;
+}
+
 // NB: delete_block only called by GC
 //
 // Nowdays, may be concurrently executed with 'truncate_prefix_blocks', need handle follow cases:
@@ -652,6 +663,10 @@ int LogEngine::get_total_used_disk_space(int64_t &total_used_size_byte) const
   } else {
     log_storage_used = (max_block_id - min_block_id) * (PALF_BLOCK_SIZE + MAX_INFO_BLOCK_SIZE)
       + lsn_2_offset(log_storage_.get_end_lsn(), PALF_BLOCK_SIZE) + MAX_INFO_BLOCK_SIZE;
+    // the prepared next block has been taken from log block pool, it's used by this palf
+    if (log_storage_.has_prepared_block()) {
+      log_storage_used += PALF_BLOCK_SIZE + MAX_INFO_BLOCK_SIZE;
+    }
     PALF_LOG(TRACE, "log_storage_used size", K(min_block_id), K(max_block_id), K(log_storage_used));
   }
   // calc meta storage used
@@ -140,6 +140,7 @@ public:
   int truncate(const LSN &lsn);
   int truncate_prefix_blocks(const LSN &lsn);
   int delete_block(const block_id_t &block_id);
+  int prepare_next_block();
 
   const LSN get_begin_lsn() const;
   int get_block_id_range(block_id_t &min_block_id, block_id_t &max_block_id) const;
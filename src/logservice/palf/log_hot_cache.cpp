@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "log_hot_cache.h"
+#include "lib/atomic/ob_atomic.h"               // ATOMIC_*
+#include "share/rc/ob_tenant_base.h"            // mtl_malloc
+#include "log_writer_utils.h"                   // LogWriteBuf
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+namespace palf
+{
+LogHotCache::LogHotCache()
+  : buf_(NULL),
+    start_lsn_(0),
+    end_lsn_(0),
+    seq_(0),
+    lock_()
+{
+}
+
+LogHotCache::~LogHotCache()
+{
+  destroy();
+}
+
+void LogHotCache::destroy()
+{
+  ObSpinLockGuard guard(lock_);
+  if (NULL != buf_) {
+    mtl_free(buf_);
+    buf_ = NULL;
+  }
+  start_lsn_ = 0;
+  end_lsn_ = 0;
+  seq_ = 0;
+}
+
+void LogHotCache::fill(const LSN &lsn, const LogWriteBuf &write_buf)
+{
+  const int64_t total_size = write_buf.get_total_size();
+  const offset_t new_end_lsn = lsn.val_ + total_size;
+  // a reset racing with the copy would be overwritten by the stale 'end_lsn_' published below
+  ObSpinLockGuard guard(lock_);
+  if (NULL == buf_
+      && NULL == (buf_ = static_cast<char *>(mtl_malloc(HOT_CACHE_SIZE, "PalfHotCache")))) {
+    PALF_LOG(WARN, "alloc hot cache failed, readers will read disk", K(lsn));
+  } else if (total_size > HOT_CACHE_SIZE) {
+    inner_reset_(new_end_lsn);
+  } else {
+    if (lsn.val_ != end_lsn_) {
+      inner_reset_(lsn.val_);
+    }
+    // make the readers aware of the data to be overwritten before copying
+    if (new_end_lsn - start_lsn_ > HOT_CACHE_SIZE) {
+      ATOMIC_STORE(&start_lsn_, new_end_lsn - HOT_CACHE_SIZE);
+      MEM_BARRIER();
+    }
+    offset_t curr_lsn = lsn.val_;
+    for (int64_t i = 0; i < write_buf.get_buf_count(); i++) {
+      const char *buf = NULL;
+      int64_t buf_len = 0;
+      (void)write_buf.get_write_buf(i, buf, buf_len);
+      while (buf_len > 0) {
+        const int64_t pos = curr_lsn % HOT_CACHE_SIZE;
+        const int64_t copy_len = MIN(buf_len, HOT_CACHE_SIZE - pos);
+        MEMCPY(buf_ + pos, buf, copy_len);
+        buf += copy_len;
+        buf_len -= copy_len;
+        curr_lsn += copy_len;
+      }
+    }
+    MEM_BARRIER();
+    ATOMIC_STORE(&end_lsn_, new_end_lsn);
+  }
+}
+
+void LogHotCache::truncate(const LSN &lsn)
+{
+  ObSpinLockGuard guard(lock_);
+  if (lsn.val_ < ATOMIC_LOAD(&end_lsn_)) {
+    ATOMIC_INC(&seq_);
+    MEM_BARRIER();
+    ATOMIC_STORE(&end_lsn_, lsn.val_);
+    if (start_lsn_ > lsn.val_) {
+      ATOMIC_STORE(&start_lsn_, lsn.val_);
+    }
+    MEM_BARRIER();
+    ATOMIC_INC(&seq_);
+  }
+}
+
+void LogHotCache::reset(const LSN &lsn)
+{
+  ObSpinLockGuard guard(lock_);
+  inner_reset_(lsn.val_);
+}
+
+void LogHotCache::inner_reset_(const offset_t lsn_val)
+{
+  ATOMIC_INC(&seq_);
+  MEM_BARRIER();
+  ATOMIC_STORE(&start_lsn_, lsn_val);
+  ATOMIC_STORE(&end_lsn_, lsn_val);
+  MEM_BARRIER();
+  ATOMIC_INC(&seq_);
+}
+
+int LogHotCache::read(const LSN &lsn, const int64_t size, char *buf) const
+{
+  int ret = OB_ENTRY_NOT_EXIST;
+  const int64_t seq = ATOMIC_LOAD(&seq_);
+  const offset_t end_lsn = ATOMIC_LOAD(&end_lsn_);
+  const offset_t start_lsn = ATOMIC_LOAD(&start_lsn_);
+  if (NULL == ATOMIC_LOAD(&buf_) || 0 != (seq & 1) || 0 >= size || size > HOT_CACHE_SIZE) {
+  } else if (lsn.val_ < start_lsn || lsn.val_ + size > end_lsn) {
+  } else {
+    const int64_t pos = lsn.val_ % HOT_CACHE_SIZE;
+    const int64_t first_len = MIN(size, HOT_CACHE_SIZE - pos);
+    MEMCPY(buf, buf_ + pos, first_len);
+    if (first_len < size) {
+      MEMCPY(buf + first_len, buf_, size - first_len);
+    }
+    MEM_BARRIER();
+    // the data may be overwritten or truncated while copying
+    if (seq == ATOMIC_LOAD(&seq_) && lsn.val_ >= ATOMIC_LOAD(&start_lsn_)) {
+      ret = OB_SUCCESS;
+    }
+  }
+  return ret;
+}
+} // end namespace palf
+} // end namespace oceanbase
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LOGSERVICE_LOG_HOT_CACHE_
+#define OCEANBASE_LOGSERVICE_LOG_HOT_CACHE_
+
+#include <stdint.h>
+#include "lib/utility/ob_print_utils.h"         // TO_STRING_KV
+#include "lib/lock/ob_spin_lock.h"              // ObSpinLock
+#include "lsn.h"                                // LSN
+
+namespace oceanbase
+{
+namespace palf
+{
+struct LogWriteBuf;
+
+// LogHotCache keeps the latest flushed log data of one palf instance in memory, so that
+// the readers near the log tail (fetch log of lagging followers, replay, CDC and archive)
+// don't need to read disk.
+//
+// It's a ring buffer indexed by LSN, data of 'lsn' is stored at 'lsn % HOT_CACHE_SIZE'.
+// NB: the writers (fill by the flush thread of LogIOWorker, truncate and reset by the
+// truncate and rebuild paths) are serialized by 'lock_', readers are lock-free:
+// 1. before overwriting the oldest data, the writer advances 'start_lsn_' firstly, a reader
+//    checks 'start_lsn_' again after copying data to make sure what it read is not overwritten;
+// 2. truncate and reset are protected by 'seq_', which is odd while they are in progress.
+class LogHotCache
+{
+public:
+  LogHotCache();
+  ~LogHotCache();
+  void destroy();
+  // @brief append the data which has been flushed at 'lsn', the buffer is allocated
+  // lazily. If 'lsn' is not continuous with the cached data, the cache restarts from
+  // 'lsn'. Failing to fill cache is not an error, the readers will read disk.
+  void fill(const LSN &lsn, const LogWriteBuf &write_buf);
+  // @brief drop the cached data after 'lsn'.
+  void truncate(const LSN &lsn);
+  // @brief drop all cached data, and the next data will be filled from 'lsn'.
+  void reset(const LSN &lsn);
+  // @brief copy [lsn, lsn + size) into 'buf'.
+  // @retval
+  //   OB_SUCCESS
+  //   OB_ENTRY_NOT_EXIST, the range is not in cache completely.
+  int read(const LSN &lsn, const int64_t size, char *buf) const;
+  TO_STRING_KV(KP(buf_), K_(start_lsn), K_(end_lsn), K_(seq));
+public:
+  static constexpr int64_t HOT_CACHE_SIZE = 4 * 1024 * 1024L;
+private:
+  void inner_reset_(const offset_t lsn_val);
+private:
+  char *buf_;
+  // [start_lsn_, end_lsn_) has been cached
+  offset_t start_lsn_;
+  offset_t end_lsn_;
+  int64_t seq_;
+  common::ObSpinLock lock_;
+  DISALLOW_COPY_AND_ASSIGN(LogHotCache);
+};
+} // end namespace palf
+} // end namespace oceanbase
+
+#endif
@@ -15,6 +15,10 @@
 #include "log_rpc_proxy.h"                         // LogRpcProxyV2
 #include "log_rpc_packet.h"                        // LogRpcPaket
 #include "log_req.h"                               // LogPushReq...
+#include "observer/ob_server_struct.h"             // GCTX
+#include "share/config/ob_server_config.h"         // GCONF
+#include "share/rpc/ob_batch_rpc.h"                // ObBatchRpc
+#include "rpc/obrpc/ob_rpc_net_handler.h"          // ObRpcNetHandler
 
 namespace oceanbase
 {
@@ -54,5 +58,39 @@ void LogRpc::destroy()
     PALF_LOG(INFO, "LogRpc destroy success");
   }
 }
+
+bool LogRpc::need_batch_rpc_() const
+{
+  return NULL != GCTX.batch_rpc_
+      && GCONF._enable_palf_batch_rpc;
+}
+
+template<class ReqType>
+int LogRpc::post_batch_packet_(const common::ObAddr &server,
+                               const LogBatchReqType type,
+                               const LogRpcPacketImpl<ReqType> &packet)
+{
+  int ret = OB_SUCCESS;
+  LogBatchPacketFiller<ReqType> filler(packet);
+  if (OB_FAIL(GCTX.batch_rpc_->post(MTL_ID(), server, obrpc::ObRpcNetHandler::CLUSTER_ID,
+      obrpc::CLOG_BATCH_REQ_NODELAY, type, filler))) {
+    PALF_LOG(WARN, "post batch packet failed", K(ret), K(server), K(type), K(packet));
+  }
+  return ret;
+}
+
+int LogRpc::post_packet_(const common::ObAddr &server,
+                         const LogRpcPacketImpl<LogPushReq> &packet)
+{
+  return need_batch_rpc_() ? post_batch_packet_(server, LOG_BATCH_PUSH_REQ, packet)
+      : rpc_proxy_.post_packet(server, packet, MTL_ID());
+}
+
+int LogRpc::post_packet_(const common::ObAddr &server,
+                         const LogRpcPacketImpl<LogPushResp> &packet)
+{
+  return need_batch_rpc_() ? post_batch_packet_(server, LOG_BATCH_PUSH_RESP, packet)
+      : rpc_proxy_.post_packet(server, packet, MTL_ID());
+}
 } // end namespace palf
 } // end namespace oceanbase
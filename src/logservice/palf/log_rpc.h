@@ -21,6 +21,8 @@
 #include "log_rpc_macros.h"                        // MACROS...
 #include "log_rpc_packet.h"                        // LogRpcPacketImpl
 #include "log_rpc_proxy.h"                         // LogRpcProxyV2
+#include "log_req.h"                               // LogPushReq
+#include "share/rpc/ob_batch_proxy.h"              // ObIFill
 #include "share/resource_manager/ob_cgroup_ctrl.h"
 
 namespace oceanbase
@@ -66,6 +68,35 @@ namespace palf
 //    in log_rpc_processor.h and log_rpc_processor.cpp.
 //
 //    NB: Above processor used to LogPacketHandler
+// LogPushReq and LogPushResp are the most frequent messages, a server with
+// thousands of log streams sends thousands of them per second. They are posted
+// by ObBatchRpc, so the messages of all palf instances to the same server are
+// coalesced into one batch packet, and the batch is sent by the BRPC thread while
+// the next one is being filled.
+enum LogBatchReqType
+{
+  LOG_BATCH_PUSH_REQ = 1,
+  LOG_BATCH_PUSH_RESP = 2,
+};
+
+template <typename ReqType>
+class LogBatchPacketFiller : public obrpc::ObIFill
+{
+public:
+  explicit LogBatchPacketFiller(const LogRpcPacketImpl<ReqType> &packet) : packet_(packet) {}
+  ~LogBatchPacketFiller() {}
+  int fill_buffer(char *buf, int64_t size, int64_t &filled_size) const override
+  {
+    filled_size = 0;
+    return packet_.serialize(buf, size, filled_size);
+  }
+  int64_t get_req_size() const override { return packet_.get_serialize_size(); }
+  // the thread local buffer is not enough for a big LogPushReq, alloc it dynamically
+  int64_t get_estimate_size() const override { return get_req_size(); }
+private:
+  const LogRpcPacketImpl<ReqType> &packet_;
+};
+
 class LogRpc {
 public:
   LogRpc();
@@ -86,7 +117,7 @@ public:
       ret = OB_INVALID_ARGUMENT;
     } else {
       LogRpcPacketImpl<ReqType> packet(self_, palf_id, req);
-      ret = rpc_proxy_.post_packet(server, packet, MTL_ID());
+      ret = post_packet_(server, packet);
     }
     return ret;
   }
@@ -116,6 +147,24 @@ public:
   }
 
   TO_STRING_KV(K_(self), K_(is_inited));
+private:
+  template<class ReqType>
+  int post_packet_(const common::ObAddr &server,
+                   const LogRpcPacketImpl<ReqType> &packet)
+  {
+    return rpc_proxy_.post_packet(server, packet, MTL_ID());
+  }
+  int post_packet_(const common::ObAddr &server,
+                   const LogRpcPacketImpl<LogPushReq> &packet);
+  int post_packet_(const common::ObAddr &server,
+                   const LogRpcPacketImpl<LogPushResp> &packet);
+  template<class ReqType>
+  int post_batch_packet_(const common::ObAddr &server,
+                         const LogBatchReqType type,
+                         const LogRpcPacketImpl<ReqType> &packet);
+  // the receiver of old version drops the batch packet of palf, so batch rpc is
+  // only used after it is enabled by _enable_palf_batch_rpc
+  bool need_batch_rpc_() const;
 private:
   ObAddr self_;
   obrpc::LogRpcProxyV2 rpc_proxy_;
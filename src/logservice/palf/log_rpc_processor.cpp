@@ -42,5 +42,20 @@ int __get_palf_env_impl(uint64_t tenant_id, PalfEnvImpl *&palf_env_impl)
 	return ret;
 }
 
+int handle_log_batch_req(const int type, const char *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  PalfEnvImpl *palf_env_impl = NULL;
+  if (OB_ISNULL(buf) || 0 >= size) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(type), KP(buf), K(size));
+  } else if (OB_FAIL(__get_palf_env_impl(MTL_ID(), palf_env_impl))) {
+    PALF_LOG(WARN, "__get_palf_env_impl failed", K(ret), K(type));
+  } else if (OB_FAIL(palf_env_impl->push_log_batch_req(type, buf, size))) {
+    PALF_LOG(WARN, "push_log_batch_req failed", K(ret), K(type), K(size));
+  }
+  return ret;
+}
+
 } // end namespace palf
 } // end namespace oceanbase
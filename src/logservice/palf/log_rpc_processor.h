@@ -31,6 +31,9 @@ namespace palf
 {
 
 int __get_palf_env_impl(uint64_t tenant_id, PalfEnvImpl *&palf_env_impl);
+// dispatch LogPushReq and LogPushResp coalesced in the batch packet of ObBatchRpc
+// to LogBatchReqThreadPool, 'type' is LogBatchReqType.
+int handle_log_batch_req(const int type, const char *buf, const int64_t size);
 
 DEFINE_RPC_PROCESSOR(LogPushReqP,
                      obrpc::LogRpcProxyV2,
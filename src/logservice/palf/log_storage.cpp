@@ -14,6 +14,7 @@
 #include "log_storage.h"
 #include "lib/ob_errno.h"            // OB_INVALID_ARGUMENT
 #include "share/rc/ob_tenant_base.h" // mtl_malloc
+#include "lib/stat/ob_diagnose_info.h" // EVENT_INC
 #include "log_reader_utils.h"        // ReadBuf
 
 namespace oceanbase
@@ -26,6 +27,7 @@ class LogReader;
 LogStorage::LogStorage() :
     block_mgr_(),
     log_reader_(),
+    hot_cache_(),
     log_tail_(),
     log_block_header_(),
     curr_block_writable_size_(0),
@@ -98,6 +100,7 @@ void LogStorage::destroy()
   logical_block_size_ = 0;
   block_mgr_.destroy();
   log_reader_.destroy();
+  hot_cache_.destroy();
   log_tail_.reset();
   log_block_header_.reset();
   curr_block_writable_size_ = 0;
@@ -138,6 +141,8 @@ int LogStorage::writev(const LSN &lsn, const LogWriteBuf &write_buf, const int64
     PALF_LOG(ERROR, "LogVirtualFileMgr writev failed", K(ret), K(write_buf), K(lsn));
   } else {
     curr_block_writable_size_ -= write_size;
+    // fill hot cache before advancing 'log_tail_', the data is readable after that
+    hot_cache_.fill(lsn, write_buf);
     update_log_tail_guarded_by_lock_(write_size);
     PALF_LOG(TRACE, "LogStorage writev success", K(ret), K(log_block_header_), K(lsn),
              K(log_tail_), K(write_buf), KPC(this));
@@ -324,6 +329,7 @@ int LogStorage::inner_truncate_(const LSN &lsn)
     curr_block_writable_size_ = logical_block_size_ - logical_offset;
     need_append_block_header_ =
         (curr_block_writable_size_ == logical_block_size_) ? true : false;
+    hot_cache_.truncate(lsn);
     log_tail_ = lsn;
     PALF_LOG(INFO, "inner_truncate_ success", K(ret), K(lsn), KPC(this));
   }
@@ -378,6 +384,7 @@ int LogStorage::truncate_prefix_blocks(const LSN &lsn)
     PALF_LOG(WARN, "need reset log_tail", K(ret), K(block_id),
              KPC(this));
     ObSpinLockGuard guard(tail_info_lock_);
+    hot_cache_.reset(lsn);
     log_tail_ = lsn;
     log_block_header_.reset();
     curr_block_writable_size_ = 0;
@@ -406,6 +413,19 @@ int LogStorage::delete_block(const block_id_t &block_id)
   return ret;
 }
 
+int LogStorage::prepare_next_block()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (lsn_2_offset(get_end_lsn(), logical_block_size_) < logical_block_size_ / 2) {
+    // not need to hold a block from log block pool for idle palf
+  } else if (OB_FAIL(block_mgr_.prepare_next_block())) {
+    PALF_LOG(WARN, "LogBlockMgr prepare_next_block failed", K(ret), KPC(this));
+  }
+  return ret;
+}
+
 int LogStorage::get_block_id_range(block_id_t &min_block_id,
                                    block_id_t &max_block_id) const
 {
@@ -741,6 +761,12 @@ int LogStorage::inner_pread_(const LSN &read_lsn,
   if (read_lsn >= log_tail) {
     ret = OB_ERR_OUT_OF_UPPER_BOUND;
     PALF_LOG(WARN, "read something out of upper bound", K(ret), K(read_lsn), K(log_tail_));
+  } else if ((0 != read_offset || false == need_read_log_block_header)
+             && real_in_read_size <= read_buf.buf_len_
+             && OB_SUCCESS == hot_cache_.read(read_lsn, real_in_read_size, read_buf.buf_)) {
+    out_read_size = real_in_read_size;
+    EVENT_INC(CLOG_CACHE_HIT_COUNT);
+    PALF_LOG(TRACE, "inner_pread hit hot cache", K(ret), K(read_lsn), K(real_in_read_size));
   } else if (OB_FAIL(log_reader_.pread(read_block_id,
                                        real_read_offset,
                                        real_in_read_size,
@@ -749,6 +775,8 @@ int LogStorage::inner_pread_(const LSN &read_lsn,
     PALF_LOG(
         WARN, "LogReader pread failed", K(ret), K(read_lsn), K(log_tail_), K(real_in_read_size));
   } else {
+    EVENT_INC(CLOG_DISK_READ_COUNT);
+    EVENT_ADD(CLOG_DISK_READ_SIZE, out_read_size);
     PALF_LOG(TRACE,
              "inner_pread success",
              K(ret),
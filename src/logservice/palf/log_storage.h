@@ -17,6 +17,7 @@
 #include "share/ob_errno.h"        // errno
 #include "log_block_header.h"      // LogBlockHeader
 #include "log_block_mgr.h"         // LogBlockMgr
+#include "log_hot_cache.h"         // LogHotCache
 #include "log_reader.h"            // LogReader
 #include "log_storage_interface.h" // ILogStorage
 #include "log_writer_utils.h"      // LogWriteBuf
@@ -84,6 +85,10 @@ public:
   int truncate(const LSN &lsn);
   int truncate_prefix_blocks(const LSN &lsn);
   int delete_block(const block_id_t &block_id);
+  // @brief prepare the next block in background when the log tail has passed half of
+  // current block, see LogBlockMgr::prepare_next_block.
+  int prepare_next_block();
+  bool has_prepared_block() const { return block_mgr_.has_prepared_block(); }
   int get_block_id_range(block_id_t &min_block_id, block_id_t &max_block_id) const;
   // @retval
   //   OB_SUCCESS
@@ -144,6 +149,8 @@ private:
   // Used to perform IO tasks in the background
   LogBlockMgr block_mgr_;
   LogReader log_reader_;
+  // the latest flushed data, consulted before reading disk
+  LogHotCache hot_cache_;
   LSN log_tail_;
   LogBlockHeader log_block_header_;
   // Used to detemine whether need switch block.
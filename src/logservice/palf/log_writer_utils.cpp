@@ -150,6 +150,9 @@ DEFINE_SERIALIZE(LogWriteBuf)
     ret = OB_INVALID_ARGUMENT;
   } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, new_pos, total_size))) {
     PALF_LOG(ERROR, "LogWriteBuf serialize failed", K(ret), K(pos), K(new_pos), K(buf_len));
+  } else if (new_pos + total_size > buf_len) {
+    ret = OB_BUF_NOT_ENOUGH;
+    PALF_LOG(WARN, "LogWriteBuf serialize buf not enough", K(ret), K(new_pos), K(total_size), K(buf_len));
   } else {
     for (int64_t i = 0; OB_SUCC(ret) && i < write_buf_.count(); i++) {
       const int64_t tmp_buf_len = write_buf_[i].buf_len_;
@@ -171,6 +174,9 @@ DEFINE_DESERIALIZE(LogWriteBuf)
     ret = OB_INVALID_ARGUMENT;
   } else if (OB_FAIL(serialization::decode_i64(buf, data_len, new_pos, &total_size))) {
     PALF_LOG(ERROR, "LogWriteBuf deserialize failed", K(ret), K(pos), K(new_pos), K(data_len));
+  } else if (0 > total_size || new_pos + total_size > data_len) {
+    ret = OB_DESERIALIZE_ERROR;
+    PALF_LOG(WARN, "LogWriteBuf data is truncated", K(ret), K(new_pos), K(total_size), K(data_len));
   } else {
     InnerStruct inner_struct;
     inner_struct.buf_ = buf + new_pos;
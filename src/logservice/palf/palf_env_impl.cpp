@@ -25,6 +25,7 @@
 #include "palf_handle_impl_guard.h"             // PalfHandleImplGuard
 #include "palf_handle.h"
 #include "log_loop_thread.h"
+#include "log_block_prepare_thread.h"
 #include "log_rpc.h"
 #include "log_block_pool_interface.h"
 
@@ -114,6 +115,7 @@ PalfEnvImpl::PalfEnvImpl() : palf_meta_lock_(),
                              fetch_log_engine_(),
                              log_rpc_(),
                              cb_thread_pool_(),
+                             batch_req_thread_pool_(),
                              log_io_worker_(),
                              disk_options_wrapper_(),
                              check_disk_print_log_interval_(OB_INVALID_TIMESTAMP),
@@ -159,6 +161,8 @@ int PalfEnvImpl::init(
     PALF_LOG(ERROR, "LogRpc init failed", K(ret));
   } else if (OB_FAIL(cb_thread_pool_.init(this))) {
     PALF_LOG(ERROR, "LogIOTaskThreadPool init failed", K(ret));
+  } else if (OB_FAIL(batch_req_thread_pool_.init(this))) {
+    PALF_LOG(ERROR, "LogBatchReqThreadPool init failed", K(ret));
   } else if (OB_FAIL(log_io_worker_.init(log_io_worker_config_,
                                          cb_thread_pool_.get_tg_id(),
                                          log_alloc_mgr, this))) {
@@ -175,6 +179,8 @@ int PalfEnvImpl::init(
     PALF_LOG(ERROR, "palf_handle_impl_map_ init failed", K(ret));
   } else if (OB_FAIL(log_loop_thread_.init(this))) {
     PALF_LOG(ERROR, "log_loop_thread_ init failed", K(ret));
+  } else if (OB_FAIL(log_block_prepare_thread_.init(this))) {
+    PALF_LOG(ERROR, "log_block_prepare_thread_ init failed", K(ret));
   } else if (OB_FAIL(
                  election_timer_.init_and_start(1, 1_ms, "ElectTimer"))) { // just one worker thread
     PALF_LOG(ERROR, "election_timer_ init failed", K(ret));
@@ -205,6 +211,8 @@ int PalfEnvImpl::start()
     PALF_LOG(WARN, "scan_all_palf_handle_impl_director_ failed", K(ret));
   } else if (OB_FAIL(cb_thread_pool_.start())) {
     PALF_LOG(ERROR, "LogIOTaskThreadPool start failed", K(ret));
+  } else if (OB_FAIL(batch_req_thread_pool_.start())) {
+    PALF_LOG(ERROR, "LogBatchReqThreadPool start failed", K(ret));
   } else if (OB_FAIL(log_io_worker_.start())) {
     PALF_LOG(ERROR, "LogIOWorker start failed", K(ret));
   } else if (OB_FAIL(block_gc_timer_task_.start())) {
@@ -213,6 +221,8 @@ int PalfEnvImpl::start()
     PALF_LOG(ERROR, "FetchLogEngine start failed", K(ret));
   } else if (OB_FAIL(log_loop_thread_.start())) {
     PALF_LOG(ERROR, "log_loop_thread_ start failed", K(ret));
+  } else if (OB_FAIL(log_block_prepare_thread_.start())) {
+    PALF_LOG(ERROR, "log_block_prepare_thread_ start failed", K(ret));
   } else {
     is_running_ = true;
     PALF_LOG(INFO, "PalfEnv start success", K(ret), K(MTL_ID()));
@@ -227,9 +237,11 @@ void PalfEnvImpl::stop()
     is_running_ = false;
     log_io_worker_.stop();
     cb_thread_pool_.stop();
+    batch_req_thread_pool_.stop();
     block_gc_timer_task_.stop();
     fetch_log_engine_.stop();
     log_loop_thread_.stop();
+    log_block_prepare_thread_.stop();
     PALF_LOG(INFO, "PalfEnvImpl stop success", KPC(this));
   }
 }
@@ -238,9 +250,11 @@ void PalfEnvImpl::wait()
 {
   log_io_worker_.wait();
   cb_thread_pool_.wait();
+  batch_req_thread_pool_.wait();
   block_gc_timer_task_.wait();
   fetch_log_engine_.wait();
   log_loop_thread_.wait();
+  log_block_prepare_thread_.wait();
   PALF_LOG(INFO, "PalfEnvImpl wait success", KPC(this));
 }
 
@@ -252,7 +266,9 @@ void PalfEnvImpl::destroy()
   palf_handle_impl_map_.destroy();
   log_io_worker_.destroy();
   cb_thread_pool_.destroy();
+  batch_req_thread_pool_.destroy();
   log_loop_thread_.destroy();
+  log_block_prepare_thread_.destroy();
   block_gc_timer_task_.destroy();
   fetch_log_engine_.destroy();
   log_rpc_.destroy();
@@ -562,6 +578,17 @@ bool PalfEnvImpl::FreezeLogFunctor::operator() (const LSKey &palf_id, PalfHandle
   return true;
 }
 
+bool PalfEnvImpl::PrepareNextBlockFunctor::operator() (const LSKey &palf_id, PalfHandleImpl *palf_handle_impl)
+{
+  int tmp_ret = OB_SUCCESS;
+  if (NULL == palf_handle_impl) {
+    PALF_LOG(ERROR, "palf_handle_impl is NULL", KP(palf_handle_impl), K(palf_id));
+  } else if (OB_SUCCESS != (tmp_ret = palf_handle_impl->prepare_next_block())) {
+    PALF_LOG(WARN, "prepare_next_block failed", K(tmp_ret), K(palf_id));
+  } else {}
+  return true;
+}
+
 bool PalfEnvImpl::CheckFreezeModeFunctor::operator() (const LSKey &palf_id, PalfHandleImpl *palf_handle_impl)
 {
   int tmp_ret = OB_SUCCESS;
@@ -612,6 +639,31 @@ int PalfEnvImpl::try_freeze_log_for_all()
   return ret;
 }
 
+int PalfEnvImpl::try_prepare_next_block_for_all()
+{
+  int ret = OB_SUCCESS;
+  PrepareNextBlockFunctor prepare_functor;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(WARN, "PalfEnvImpl is not inited", K(ret));
+  } else if (OB_FAIL(palf_handle_impl_map_.for_each(prepare_functor))) {
+    PALF_LOG(WARN, "palf_handle_impl_map_ for_each failed", K(ret));
+  } else {}
+  return ret;
+}
+
+int PalfEnvImpl::push_log_batch_req(const int type, const char *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(WARN, "PalfEnvImpl is not inited", K(ret));
+  } else if (OB_FAIL(batch_req_thread_pool_.push(type, buf, size))) {
+    PALF_LOG(WARN, "batch_req_thread_pool_ push failed", K(ret), K(type), K(size));
+  } else {}
+  return ret;
+}
+
 PalfEnvImpl::LogGetRecycableFileCandidate::LogGetRecycableFileCandidate()
   : id_(-1),
     min_block_id_(LOG_INVALID_BLOCK_ID),
@@ -24,9 +24,11 @@
 #include "share/ob_occam_timer.h"
 #include "fetch_log_engine.h"
 #include "log_loop_thread.h"
+#include "log_block_prepare_thread.h"
 #include "log_define.h"
 #include "log_io_worker.h"
 #include "log_io_task_cb_thread_pool.h"
+#include "log_batch_req_thread_pool.h"
 #include "log_rpc.h"
 #include "palf_options.h"
 #include "palf_handle_impl.h"
@@ -207,6 +209,9 @@ public:
   int try_switch_state_for_all();
   int check_and_switch_freeze_mode();
   int try_freeze_log_for_all();
+  int try_prepare_next_block_for_all();
+  // dispatch a sub request of the batch packet, see LogBatchReqThreadPool
+  int push_log_batch_req(const int type, const char *buf, const int64_t size);
   // =================== memory space management ==================
   bool check_tenant_memory_enough();
   // =================== disk space management ==================
@@ -247,6 +252,13 @@ private:
     ~FreezeLogFunctor() {}
     bool operator() (const LSKey &palf_id, PalfHandleImpl *palf_handle_impl);
   };
+  class PrepareNextBlockFunctor
+  {
+  public:
+    PrepareNextBlockFunctor() {}
+    ~PrepareNextBlockFunctor() {}
+    bool operator() (const LSKey &palf_id, PalfHandleImpl *palf_handle_impl);
+  };
   class CheckFreezeModeFunctor
   {
   public:
@@ -304,6 +316,7 @@ private:
   FetchLogEngine fetch_log_engine_;
   LogRpc log_rpc_;
   LogIOTaskCbThreadPool cb_thread_pool_;
+  LogBatchReqThreadPool batch_req_thread_pool_;
   common::ObOccamTimer election_timer_;
   LogIOWorker log_io_worker_;
   BlockGCTimerTask block_gc_timer_task_;
@@ -316,6 +329,7 @@ private:
 
   PalfHandleImplMap palf_handle_impl_map_;
   LogLoopThread log_loop_thread_;
+  LogBlockPrepareThread log_block_prepare_thread_;
 
   // last_palf_epoch_ is used to assign increasing epoch for each palf instance.
   int64_t last_palf_epoch_;
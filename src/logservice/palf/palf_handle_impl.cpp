@@ -2049,6 +2049,17 @@ int PalfHandleImpl::period_freeze_last_log()
   return ret;
 }
 
+int PalfHandleImpl::prepare_next_block()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(log_engine_.prepare_next_block())) {
+    PALF_LOG(WARN, "prepare_next_block failed", K(ret), K_(palf_id));
+  }
+  return ret;
+}
+
 int PalfHandleImpl::check_and_switch_state()
 {
   int ret = OB_SUCCESS;
@@ -782,6 +782,7 @@ public:
   int check_and_switch_state();
   int check_and_switch_freeze_mode();
   int period_freeze_last_log();
+  int prepare_next_block();
   int handle_prepare_request(const common::ObAddr &server,
                              const int64_t &proposal_id) override final;
   int handle_prepare_response(const common::ObAddr &server,
@@ -1215,46 +1215,56 @@ int ObLogReplayService::handle_replay_task_(ObReplayServiceReplayTask *task_queu
   } else {
     int64_t start_ts = ObTimeUtility::fast_current_time();
     do {
-      int64_t replay_task_used = 0;
-      int64_t destroy_task_used = 0;
-      ObLink *link = NULL;
-      ObLink *link_to_destroy = NULL;
-      ObLogReplayTask *replay_task = NULL;
-      ObLogReplayTask *replay_task_to_destroy = NULL;
       if (replay_status->try_rdlock()) {
-        if (!replay_status->is_enabled_without_lock()) {
-          is_queue_empty = true;
-        } else if (NULL == (link = task_queue->top())) {
-          //queue is empty
-          ret = OB_SUCCESS;
-          is_queue_empty = true;
-          task_queue->clear_err_info();
-        } else if (OB_ISNULL(replay_task = static_cast<ObLogReplayTask *>(link))) {
-          ret = OB_ERR_UNEXPECTED;
-          CLOG_LOG(ERROR, "replay_task is NULL", KPC(replay_status), K(ret));
-        } else if (OB_FAIL(do_replay_task_(replay_task, replay_status, task_queue->idx()))) {
-          (void)process_replay_ret_code_(ret, *replay_status, *task_queue, *replay_task);
-        } else if (OB_ISNULL(link_to_destroy = task_queue->pop())) {
-          CLOG_LOG(ERROR, "failed to pop task after replay", KPC(replay_task), K(ret));
-          //It's impossible to get to this branch. Use on_replay_error to defend it.
-          on_replay_error_(*replay_task, ret);
-        } else if (OB_ISNULL(replay_task_to_destroy = static_cast<ObLogReplayTask *>(link_to_destroy))) {
-          ret = OB_ERR_UNEXPECTED;
-          CLOG_LOG(ERROR, "replay_task_to_destroy is NULL when pop after replay", KPC(replay_task), K(ret));
-          //It's impossible to get to this branch. Use on_replay_error to defend it.
-          on_replay_error_(*replay_task, ret);
-        } else {
-          task_queue->clear_err_info();
-          if (!replay_task->is_pre_barrier_) {
-            //前向barrier日志执行回放的线程会提前释放内存
-            replay_status->dec_pending_task(replay_task->log_size_);
-          }
-          free_replay_task(replay_task_to_destroy);
-          //To avoid a single task occupies too long thread time, the upper limit of
-          //single occupancy time is set to 10ms
-          int64_t used_time = ObTimeUtility::fast_current_time() - start_ts;
-          if (used_time > MAX_REPLAY_TIME_PER_ROUND) {
-            is_timeslice_run_out = true;
+        // Replay a batch of tasks with one lock hold, the lock of replay status is shared
+        // by all replay queues and the submit task of this log stream, locking it for
+        // every task makes its cache line bounce between replay threads.
+        // NB: disable and remove take the write lock, so they wait for the whole batch, which
+        // is bounded by MAX_REPLAY_TASK_COUNT_PER_LOCK tasks and MAX_REPLAY_TIME_PER_ROUND
+        // (plus the last task). Re-checking is_enabled below only stops the batch once the
+        // status is disabled, it does not let a waiting writer in.
+        int64_t replayed_count = 0;
+        while (OB_SUCC(ret) && (!is_queue_empty) && (!is_timeslice_run_out)
+               && replayed_count < MAX_REPLAY_TASK_COUNT_PER_LOCK) {
+          ObLink *link = NULL;
+          ObLink *link_to_destroy = NULL;
+          ObLogReplayTask *replay_task = NULL;
+          ObLogReplayTask *replay_task_to_destroy = NULL;
+          if (!replay_status->is_enabled_without_lock()) {
+            is_queue_empty = true;
+          } else if (NULL == (link = task_queue->top())) {
+            //queue is empty
+            ret = OB_SUCCESS;
+            is_queue_empty = true;
+            task_queue->clear_err_info();
+          } else if (OB_ISNULL(replay_task = static_cast<ObLogReplayTask *>(link))) {
+            ret = OB_ERR_UNEXPECTED;
+            CLOG_LOG(ERROR, "replay_task is NULL", KPC(replay_status), K(ret));
+          } else if (OB_FAIL(do_replay_task_(replay_task, replay_status, task_queue->idx()))) {
+            (void)process_replay_ret_code_(ret, *replay_status, *task_queue, *replay_task);
+          } else if (OB_ISNULL(link_to_destroy = task_queue->pop())) {
+            CLOG_LOG(ERROR, "failed to pop task after replay", KPC(replay_task), K(ret));
+            //It's impossible to get to this branch. Use on_replay_error to defend it.
+            on_replay_error_(*replay_task, ret);
+          } else if (OB_ISNULL(replay_task_to_destroy = static_cast<ObLogReplayTask *>(link_to_destroy))) {
+            ret = OB_ERR_UNEXPECTED;
+            CLOG_LOG(ERROR, "replay_task_to_destroy is NULL when pop after replay", KPC(replay_task), K(ret));
+            //It's impossible to get to this branch. Use on_replay_error to defend it.
+            on_replay_error_(*replay_task, ret);
+          } else {
+            task_queue->clear_err_info();
+            if (!replay_task->is_pre_barrier_) {
+              //前向barrier日志执行回放的线程会提前释放内存
+              replay_status->dec_pending_task(replay_task->log_size_);
+            }
+            free_replay_task(replay_task_to_destroy);
+            replayed_count++;
+            //To avoid a single task occupies too long thread time, the upper limit of
+            //single occupancy time is set to 10ms
+            int64_t used_time = ObTimeUtility::fast_current_time() - start_ts;
+            if (used_time > MAX_REPLAY_TIME_PER_ROUND) {
+              is_timeslice_run_out = true;
+            }
           }
         }
         replay_status->unlock();
@@ -149,6 +149,8 @@ void ObLogRestoreService::do_thread_task_()
 {
   update_upstream_();
 
+  update_fetch_log_worker_();
+
   schedule_fetch_log_();
 
   report_error_();
@@ -159,6 +161,11 @@ void ObLogRestoreService::update_upstream_()
   (void)location_adaptor_.update_upstream();
 }
 
+void ObLogRestoreService::update_fetch_log_worker_()
+{
+  (void)fetch_log_worker_.update_thread_count();
+}
+
 void ObLogRestoreService::schedule_fetch_log_()
 {
   (void)fetch_log_impl_.do_schedule();
@@ -64,6 +64,7 @@ private:
   void run1();
   void do_thread_task_();
   void update_upstream_();
+  void update_fetch_log_worker_();
   void schedule_fetch_log_();
   void report_error_();
 
@@ -20,6 +20,8 @@
 #include "share/ob_errno.h"
 //#include "share/restore/ob_log_archive_source.h"
 #include "share/rc/ob_tenant_base.h"                    // mtl_free
+#include "lib/alloc/alloc_func.h"                       // get_tenant_memory_limit
+#include "observer/omt/ob_tenant_config_mgr.h"          // ObTenantConfigGuard
 #include "logservice/ob_log_handler.h"                  // ObLogHandler
 #include "logservice/palf/palf_base_info.h"             // PalfBaseInfo
 #include "storage/tx_storage/ob_ls_service.h"           // ObLSService
@@ -62,6 +64,7 @@ ObRemoteFetchWorker::ObRemoteFetchWorker() :
   restore_service_(NULL),
   ls_svr_(NULL),
   task_queue_(),
+  in_flight_ls_(),
   cond_()
 {}
 
@@ -83,8 +86,12 @@ int ObRemoteFetchWorker::init(const uint64_t tenant_id,
     LOG_WARN("invalid argument", K(ret), K(tenant_id), K(restore_service), K(ls_svr));
   } else if (OB_FAIL(task_queue_.init(1024 * 1024, "RFLTaskQueue", MTL_ID()))) {
     LOG_WARN("task_queue_ init failed", K(ret));
+  } else if (OB_FAIL(in_flight_ls_.create(64, "RFLInFlight", "RFLInFlight", tenant_id))) {
+    LOG_WARN("in_flight_ls_ create failed", K(ret));
+  } else if (FALSE_IT(tenant_id_ = tenant_id)) {
+  } else if (OB_FAIL(ObThreadPool::set_thread_count(calc_thread_count_()))) {
+    LOG_WARN("set thread count failed", K(ret));
   } else {
-    tenant_id_ = tenant_id;
     restore_service_ = restore_service;
     ls_svr_ = ls_svr;
     inited_ = true;
@@ -97,6 +104,7 @@ void ObRemoteFetchWorker::destroy()
   inited_ = false;
   stop();
   wait();
+  in_flight_ls_.destroy();
   ls_svr_ = NULL;
 }
 
@@ -110,7 +118,7 @@ int ObRemoteFetchWorker::start()
   } else if (OB_FAIL(ObThreadPool::start())) {
     LOG_WARN("ObRemoteFetchWorker start failed", K(ret));
   } else {
-    LOG_INFO("ObRemoteFetchWorker start succ", K_(tenant_id));
+    LOG_INFO("ObRemoteFetchWorker start succ", K_(tenant_id), "thread_num", get_thread_count());
   }
   return ret;
 }
@@ -132,6 +140,41 @@ void ObRemoteFetchWorker::signal()
   cond_.signal();
 }
 
+int ObRemoteFetchWorker::update_thread_count()
+{
+  int ret = OB_SUCCESS;
+  const int64_t thread_count = calc_thread_count_();
+  const int64_t cur_thread_count = get_thread_count();
+  if (OB_UNLIKELY(! inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObRemoteFetchWorker not init", K(ret));
+  } else if (thread_count == cur_thread_count) {
+  } else if (OB_FAIL(ObThreadPool::set_thread_count(thread_count))) {
+    LOG_WARN("set thread count failed", K(ret), K(thread_count), K(cur_thread_count));
+  } else {
+    LOG_INFO("ObRemoteFetchWorker update thread count succ", K_(tenant_id),
+        K(thread_count), K(cur_thread_count));
+  }
+  return ret;
+}
+
+int64_t ObRemoteFetchWorker::calc_thread_count_() const
+{
+  int64_t thread_count = 0;
+  {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id_));
+    if (tenant_config.is_valid()) {
+      thread_count = tenant_config->log_restore_concurrency;
+    }
+  } // end of ObTenantConfigGuard
+  if (0 == thread_count) {
+    const int64_t memory_limit = lib::get_tenant_memory_limit(tenant_id_);
+    thread_count = memory_limit * FETCH_LOG_MEMORY_PERCENTAGE / 100 / FETCH_LOG_BUF_SIZE;
+    thread_count = std::min(thread_count, MAX_FETCH_LOG_THREAD_NUM);
+  }
+  return std::max(thread_count, 1L);
+}
+
 int ObRemoteFetchWorker::submit_fetch_log_task(ObFetchLogTask *task)
 {
   int ret = OB_SUCCESS;
@@ -160,21 +203,24 @@ void ObRemoteFetchWorker::run1()
     LOG_INFO("ObRemoteFetchWorker not init");
   } else {
     while (! has_set_stop()) {
+      bool need_wait = true;
       int64_t begin_tstamp = ObTimeUtility::current_time();
-      do_thread_task_();
+      do_thread_task_(need_wait);
       int64_t end_tstamp = ObTimeUtility::current_time();
       int64_t wait_interval = THREAD_RUN_INTERVAL - (end_tstamp - begin_tstamp);
-      if (wait_interval > 0) {
+      // keep fetching without wait if the last task makes progress
+      if (need_wait && wait_interval > 0) {
         cond_.timedwait(wait_interval);
       }
     }
   }
 }
 
-void ObRemoteFetchWorker::do_thread_task_()
+void ObRemoteFetchWorker::do_thread_task_(bool &need_wait)
 {
   int ret = OB_SUCCESS;
   void *data = NULL;
+  need_wait = true;
   if (OB_FAIL(task_queue_.pop(data))) {
     if (OB_ENTRY_NOT_EXIST == ret) {
       if (REACH_TIME_INTERVAL(10 * 1000 * 1000L)) {
@@ -190,19 +236,60 @@ void ObRemoteFetchWorker::do_thread_task_()
   } else {
     ObFetchLogTask *task = static_cast<ObFetchLogTask *>(data);
     ObLSID id = task->id_;
-    if (OB_FAIL(handle(*task))) {
+    const LSN start_lsn = task->cur_lsn_;
+    bool marked = false;
+    if (OB_FAIL(mark_in_flight_(id, marked))) {
+      LOG_WARN("mark in flight failed", K(ret), KPC(task));
+    } else if (! marked) {
+      // the previous task of the log stream is still being handled by another thread,
+      // e.g. a stale task of the previous leader, retry it later
+      LOG_TRACE("log stream has task in flight, retry later", KPC(task));
+    } else if (OB_FAIL(handle(*task))) {
       LOG_WARN("handle task failed", K(ret), KPC(task));
+    } else {
+      need_wait = task->cur_lsn_ == start_lsn;
     }
 
-    // only fatal error report fail, retry with others
-    if (is_fatal_error_(ret)) {
-      report_error_(id, ret);
+    if (! marked) {
+      if (OB_FAIL(task_queue_.push(task))) {
+        LOG_ERROR("push failed", K(ret), KPC(task));
+      }
+    } else {
+      // only fatal error report fail, retry with others
+      if (is_fatal_error_(ret)) {
+        report_error_(id, ret);
+      }
+
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = try_retire_(task))) {
+        LOG_WARN("retire task failed", K(tmp_ret), KPC(task));
+      }
+      unmark_in_flight_(id);
     }
+  }
+}
 
-    int tmp_ret = OB_SUCCESS;
-    if (OB_SUCCESS != (tmp_ret = try_retire_(task))) {
-      LOG_WARN("retire task failed", K(tmp_ret), KPC(task));
+int ObRemoteFetchWorker::mark_in_flight_(const ObLSID &id, bool &marked)
+{
+  int ret = OB_SUCCESS;
+  marked = false;
+  if (OB_FAIL(in_flight_ls_.set_refactored(id, 0 /*not overwrite*/))) {
+    if (OB_HASH_EXIST == ret) {
+      ret = OB_SUCCESS;
+    } else {
+      LOG_WARN("set in flight ls failed", K(ret), K(id));
     }
+  } else {
+    marked = true;
+  }
+  return ret;
+}
+
+void ObRemoteFetchWorker::unmark_in_flight_(const ObLSID &id)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(in_flight_ls_.erase_refactored(id))) {
+    LOG_ERROR("erase in flight ls failed", K(ret), K(id));
   }
 }
 
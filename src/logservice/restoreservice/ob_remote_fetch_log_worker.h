@@ -14,6 +14,7 @@
 #define OCEANBASE_LOGSERVICE_OB_REMOTE_FETCH_LOG_WORKER_H_
 
 #include "lib/queue/ob_lighty_queue.h"      // ObLightyQueue
+#include "lib/hash/ob_hashset.h"            // ObHashSet
 #include "common/ob_queue_thread.h"         // ObCond
 #include "share/ob_thread_pool.h"           // ObThreadPool
 #include "share/ob_ls_id.h"                 // ObLSID
@@ -41,8 +42,20 @@ class ObLogRestoreService;
 using oceanbase::share::ObLSID;
 using oceanbase::palf::LSN;
 // Remote fetch log worker
+//
+// Fetch log tasks of different log streams are handled by several threads in parallel,
+// while one log stream has at most one task in flight, so logs of a log stream are still
+// submitted to ObLogRestoreHandler in LSN order.
+//
+// The thread count is log_restore_concurrency of the tenant, or decided by the memory of
+// the tenant if it's 0, as every thread may hold a data buffer of 128M when reading
+// archive files.
 class ObRemoteFetchWorker : public share::ObThreadPool
 {
+  static const int64_t FETCH_LOG_BUF_SIZE = 128 * 1024 * 1024L;
+  // the data buffers take at most 5% of the tenant memory
+  static const int64_t FETCH_LOG_MEMORY_PERCENTAGE = 5;
+  static const int64_t MAX_FETCH_LOG_THREAD_NUM = 8;
 public:
   ObRemoteFetchWorker();
   ~ObRemoteFetchWorker();
@@ -53,6 +66,8 @@ public:
   void stop();
   void wait();
   void signal();
+  // adjust the thread count to log_restore_concurrency or the tenant memory
+  int update_thread_count();
 public:
   // submit fetch log task
   //
@@ -62,7 +77,10 @@ public:
 
 private:
   void run1();
-  void do_thread_task_();
+  void do_thread_task_(bool &need_wait);
+  int64_t calc_thread_count_() const;
+  int mark_in_flight_(const ObLSID &id, bool &marked);
+  void unmark_in_flight_(const ObLSID &id);
   int handle(ObFetchLogTask &task);
   int get_upper_limit_ts_(const ObLSID &id, int64_t &ts);
   int submit_entries_(const ObLSID &id, const int64_t upper_limit_ts, ObRemoteLogIterator &iter, int64_t &max_submit_log_ts);
@@ -82,6 +100,8 @@ private:
   ObLogRestoreService *restore_service_;
   storage::ObLSService *ls_svr_;
   common::ObLightyQueue task_queue_;
+  // log streams whose task is being handled by a thread
+  common::hash::ObHashSet<ObLSID> in_flight_ls_;
 
   common::ObCond cond_;
 private:
@@ -833,6 +833,11 @@ bool ObIOHandle::is_valid() const
   return nullptr != req_;
 }
 
+bool ObIOHandle::is_finished() const
+{
+  return nullptr != req_ && ATOMIC_LOAD(&req_->is_finished_);
+}
+
 int ObIOHandle::wait(const int64_t timeout_ms)
 {
   int ret = OB_SUCCESS;
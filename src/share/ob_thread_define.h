@@ -118,4 +118,8 @@ TG_DEF(DDLScanTask, DDLScanTask, "", TG_STATIC, TIMER)
 TG_DEF(TenantLSMetaChecker, LSMetaCh, "", TG_STATIC, TIMER)
 TG_DEF(TenantTabletMetaChecker, TbMetaCh, "", TG_STATIC, TIMER)
 TG_DEF(ServerMetaChecker, SvrMetaCh, "", TG_STATIC, TIMER)
+TG_DEF(LogBatchReqThreadPool, LogBatchReq, "", TG_STATIC, QUEUE_THREAD,
+       ThreadCountPair(palf::LogBatchReqThreadPool::THREAD_NUM,
+       palf::LogBatchReqThreadPool::MINI_MODE_THREAD_NUM),
+       palf::LogBatchReqThreadPool::MAX_LOG_BATCH_REQ_TASK_NUM)
 #endif
@@ -19,6 +19,7 @@
 #include "rootserver/ob_index_builder.h"
 #include "observer/ob_srv_deliver.h"
 #include "logservice/palf/log_io_task_cb_thread_pool.h"
+#include "logservice/palf/log_batch_req_thread_pool.h"
 #include "logservice/palf/log_io_worker.h"
 #include "logservice/palf/log_define.h"
 #include "logservice/palf/fetch_log_engine.h"
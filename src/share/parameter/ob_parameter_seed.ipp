@@ -522,11 +522,11 @@ DEF_INT(log_disk_percentage, OB_CLUSTER_PARAMETER, "0", "[0,99]",
 //         "control if enable log archive",
 //         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
-// TODO(shuning.tsn) : add the feature on 4.1
-//DEF_INT(log_restore_concurrency, OB_CLUSTER_PARAMETER, "10", "[1,]",
-//        "concurrency for log restoring"
-//        "Range: [1, ] in integer",
-//        ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(log_restore_concurrency, OB_TENANT_PARAMETER, "0", "[0, 100]",
+        "concurrency of fetching archived log for restore, "
+        "0 means it is decided by the memory of the tenant. "
+        "Range: [0, 100] in integer",
+        ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 // TODO(shuning.tsn) : add the feature on 4.1
 //DEF_INT(log_archive_concurrency, OB_CLUSTER_PARAMETER, "0", "[0,]",
@@ -1314,4 +1314,12 @@ DEF_BOOL(enable_cgroup, OB_CLUSTER_PARAMETER, "True",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
 DEF_TIME(_ob_plan_cache_auto_flush_interval, OB_CLUSTER_PARAMETER, "0s", "[0s,)",
          "time interval for auto periodic flush plan cache. Range: [0s, +∞)",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_palf_batch_rpc, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether palf push log and ack messages are sent by batch rpc. "
+         "enable it only after all observers can handle clog batch packets",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_das_task_aggregation, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether remote das dml tasks to the same server are sent in one rpc. "
+         "enable it only after all observers can execute aggregated das tasks",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
\ No newline at end of file
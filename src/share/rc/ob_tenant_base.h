@@ -95,6 +95,10 @@ namespace compaction
   class ObTenantCompactionProgressMgr;
   class ObServerCompactionEventHistory;
 }
+namespace blocksstable
+{
+  class ObEncodingHintCache;
+}
 namespace memtable
 {
   class ObLockWaitMgr;
@@ -203,6 +207,7 @@ namespace detector
       storage::ObTenantFreezeInfoMgr*,               \
       transaction::ObTxLoopWorker *,                 \
       storage::ObAccessService*,                     \
+      blocksstable::ObEncodingHintCache*,            \
       ObTestModule*                                  \
   )
 
@@ -16,6 +16,7 @@
 #include "observer/omt/ob_th_worker.h"
 #include "observer/omt/ob_tenant.h"
 #include "storage/tx/ob_trans_service.h"
+#include "logservice/palf/log_rpc_processor.h"
 #include "lib/utility/serialization.h"
 
 namespace oceanbase
@@ -64,7 +65,8 @@ int ObBatchP::process()
           case CLOG_BATCH_REQ_NODELAY:
             // go through
           case CLOG_BATCH_REQ_NODELAY2:
-            ret = OB_NOT_SUPPORTED;
+            clog_batch_nodelay_cnt++;
+            handle_log_req(msg_type, buf + pos, req->size_ - (int32_t)pos);
             break;
           case CLOG_BATCH_REQ:
             ret = OB_NOT_SUPPORTED;
@@ -124,6 +126,11 @@ int ObBatchP::handle_tx_req(int type, const char* buf, int32_t size)
   return ret;
 }
 
+int ObBatchP::handle_log_req(int type, const char* buf, int32_t size)
+{
+  return palf::handle_log_batch_req(type, buf, size);
+}
+
 int ObBatchP::handle_sql_req(common::ObAddr& sender, int type, const char* buf, int32_t size)
 {
   UNUSED(sender);
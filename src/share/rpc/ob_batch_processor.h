@@ -30,6 +30,7 @@ protected:
   int process();
   int handle_trx_req(common::ObAddr& sender, int type, const char* buf, int32_t size);
   int handle_tx_req(int type, const char* buf, int32_t size);
+  int handle_log_req(int type, const char* buf, int32_t size);
   int handle_sql_req(common::ObAddr& sender, int type, const char* buf, int32_t size);
 private:
   DISALLOW_COPY_AND_ASSIGN(ObBatchP);
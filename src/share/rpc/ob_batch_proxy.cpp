@@ -13,6 +13,7 @@
 #include "ob_batch_proxy.h"
 #include "share/config/ob_server_config.h"
 #include "share/ob_cluster_version.h"
+#include "share/resource_manager/ob_cgroup_ctrl.h"
 
 namespace oceanbase
 {
@@ -101,7 +102,14 @@ int ObBatchRpcProxy::post_batch(uint64_t tenant_id, const common::ObAddr &addr,
   static BatchCallBack s_cb;
   BatchCallBack *cb = &s_cb;
 
-  ret = this->to(addr).dst_cluster_id(dst_cluster_id).by(tenant_id).as(OB_SERVER_TENANT_ID).post_packet(pkt, cb);
+  if (is_clog_batch_req(batch_type)) {
+    // palf messages in the batch are handled in the clog group of tenant,
+    // the same as they are sent by single rpc
+    ret = this->to(addr).dst_cluster_id(dst_cluster_id).by(tenant_id).as(OB_SERVER_TENANT_ID)
+        .group_id(share::OBCG_CLOG).post_packet(pkt, cb);
+  } else {
+    ret = this->to(addr).dst_cluster_id(dst_cluster_id).by(tenant_id).as(OB_SERVER_TENANT_ID).post_packet(pkt, cb);
+  }
   return ret;
 }
 
@@ -52,6 +52,13 @@ inline bool is_hp_rpc(const int batch_type)
   return (batch_type >= 0 && batch_type < BATCH_REQ_TYPE_COUNT) ? hp_rpc_map[batch_type] : false;
 }
 
+inline bool is_clog_batch_req(const int batch_type)
+{
+  return CLOG_BATCH_REQ == batch_type
+      || CLOG_BATCH_REQ_NODELAY == batch_type
+      || CLOG_BATCH_REQ_NODELAY2 == batch_type;
+}
+
 inline int get_batch_thread_idx(const int batch_type)
 {
   RLOCAL_INLINE(int, scount);
@@ -19,6 +19,8 @@
 #include "sql/das/ob_das_utils.h"
 #include "storage/tx/ob_trans_service.h"
 #include "sql/engine/ob_exec_context.h"
+#include "observer/ob_server_struct.h"
+#include "share/config/ob_server_config.h"
 namespace oceanbase
 {
 using namespace common;
@@ -214,9 +216,34 @@ bool ObDASRef::is_all_local_task() const
 int ObDASRef::execute_all_task()
 {
   int ret = OB_SUCCESS;
-  bool DAS_TASK_AGGREGATION = false;
-  if (DAS_TASK_AGGREGATION) {
-    // TODO(roland.qk): DAS task aggregation.
+  if (!is_execute_directly() && GCONF._enable_das_task_aggregation) {
+    //remote DML tasks to the same server are aggregated into one RPC,
+    //tasks of different op types are never mixed to keep the delete-first order,
+    //the runner of old version asserts on multi-op task arg, so it is off by default
+    ObSEArray<ObIDASTaskOp*, 8> remote_dml_tasks;
+    DASTaskIter task_iter = begin_task_iter();
+    while (OB_SUCC(ret) && !task_iter.is_end()) {
+      ObIDASTaskOp *task_op = *task_iter;
+      const bool is_remote_dml = IS_DAS_DML_OP(*task_op)
+                                 && task_op->get_tablet_loc()->server_ != GCTX.self_addr();
+      if (!remote_dml_tasks.empty()
+          && (remote_dml_tasks.at(0)->get_type() != task_op->get_type()
+              || (!is_remote_dml && has_pending_task_of_op(remote_dml_tasks, *task_op)))
+          && OB_FAIL(execute_aggregated_task(remote_dml_tasks))) {
+        //the remote tasks of the same DML operator are executed before its later local task
+        LOG_WARN("execute aggregated das task failed", K(ret));
+      } else if (is_remote_dml) {
+        if (OB_FAIL(remote_dml_tasks.push_back(task_op))) {
+          LOG_WARN("store remote dml task failed", K(ret));
+        }
+      } else if (OB_FAIL(MTL(ObDataAccessService*)->execute_das_task(*this, *task_op))) {
+        LOG_WARN("execute das task failed", K(ret));
+      }
+      ++task_iter;
+    }
+    if (OB_SUCC(ret) && OB_FAIL(execute_aggregated_task(remote_dml_tasks))) {
+      LOG_WARN("execute aggregated das task failed", K(ret));
+    }
   } else {
     DASTaskIter task_iter = begin_task_iter();
     while (OB_SUCC(ret) && !task_iter.is_end()) {
@@ -230,6 +257,65 @@ int ObDASRef::execute_all_task()
   return ret;
 }
 
+bool ObDASRef::has_pending_task_of_op(const ObIArray<ObIDASTaskOp*> &task_ops,
+                                      ObIDASTaskOp &task_op) const
+{
+  //the task ops of one DML operator share its rtdef
+  bool bret = false;
+  for (int64_t i = 0; !bret && i < task_ops.count(); ++i) {
+    bret = (task_ops.at(i)->get_rtdef() == task_op.get_rtdef());
+  }
+  return bret;
+}
+
+bool ObDASRef::can_aggregate_task(const ObIDASTaskOp &first_op, const ObIDASTaskOp &task_op) const
+{
+  //the task ops sharing a rtdef can be executed in the same RPC, the runner returns
+  //the affected rows of each op in its own task result, see ObDASSyncAccessP::process()
+  return first_op.get_tablet_loc()->server_ == task_op.get_tablet_loc()->server_
+         && first_op.snapshot_ == task_op.snapshot_;
+}
+
+int ObDASRef::execute_aggregated_task(ObIArray<ObIDASTaskOp*> &task_ops)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObIDASTaskOp*, 8> agg_ops;
+  ObSEArray<bool, 8> executed;
+  ObDataAccessService *das = MTL(ObDataAccessService*);
+  if (OB_FAIL(executed.prepare_allocate(task_ops.count()))) {
+    LOG_WARN("prepare allocate executed flags failed", K(ret), K(task_ops.count()));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+    executed.at(i) = false;
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+    if (!executed.at(i)) {
+      ObIDASTaskOp *first_op = task_ops.at(i);
+      agg_ops.reuse();
+      for (int64_t j = i; OB_SUCC(ret) && j < task_ops.count(); ++j) {
+        ObIDASTaskOp *task_op = task_ops.at(j);
+        if (executed.at(j) || !can_aggregate_task(*first_op, *task_op)) {
+          //skip it
+        } else if (OB_FAIL(agg_ops.push_back(task_op))) {
+          LOG_WARN("store aggregated task op failed", K(ret));
+        } else {
+          executed.at(j) = true;
+        }
+      }
+      if (OB_FAIL(ret)) {
+      } else if (agg_ops.count() == 1) {
+        if (OB_FAIL(das->execute_das_task(*this, *first_op))) {
+          LOG_WARN("execute das task failed", K(ret));
+        }
+      } else if (OB_FAIL(das->execute_aggregated_das_task(*this, agg_ops))) {
+        LOG_WARN("execute aggregated das task failed", K(ret), K(agg_ops.count()));
+      }
+    }
+  }
+  task_ops.reuse();
+  return ret;
+}
+
 void ObDASRef::set_frozen_node()
 {
   frozen_op_node_ = batched_tasks_.get_last_node();
@@ -94,6 +94,10 @@ public:
 private:
   DISABLE_COPY_ASSIGN(ObDASRef);
   int create_task_map();
+  bool has_pending_task_of_op(const common::ObIArray<ObIDASTaskOp*> &task_ops,
+                              ObIDASTaskOp &task_op) const;
+  bool can_aggregate_task(const ObIDASTaskOp &first_op, const ObIDASTaskOp &task_op) const;
+  int execute_aggregated_task(common::ObIArray<ObIDASTaskOp*> &task_ops);
 private:
   typedef common::ObObjNode<ObIDASTaskOp*> DasOpNode;
   //declare das allocator
@@ -14,6 +14,7 @@
 #include "sql/das/ob_das_rpc_processor.h"
 #include "sql/das/ob_data_access_service.h"
 #include "sql/das/ob_das_utils.h"
+#include "sql/das/ob_das_dml_ctx_define.h"
 #include "sql/engine/ob_exec_context.h"
 #include "observer/ob_server_struct.h"
 #include "storage/tx/ob_trans_service.h"
@@ -38,28 +39,37 @@ int ObDASSyncAccessP::before_process()
   int ret = OB_SUCCESS;
   ObDASTaskArg &task = arg_;
   ObDASTaskResp &task_resp = result_;
-  ObIDASTaskResult *task_result = nullptr;
+  ObIArray<ObIDASTaskOp*> &task_ops = task.get_task_ops();
   ObMemAttr mem_attr;
-  mem_attr.tenant_id_ = task.get_task_op()->get_tenant_id();
+  mem_attr.tenant_id_ = task_ops.empty() ? MTL_ID() : task_ops.at(0)->get_tenant_id();
   mem_attr.label_ = "DASRpcPCtx";
   exec_ctx_.get_allocator().set_attr(mem_attr);
   ObDASTaskFactory *das_factory = ObDASSyncAccessP::get_das_factory();
   if (OB_ISNULL(das_factory)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("das factory is not inited", K(ret));
+  } else if (OB_UNLIKELY(task_ops.empty())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("no das task op in task arg", K(ret), K(task));
   } else if (OB_FAIL(ObDASSyncRpcProcessor::before_process())) {
     LOG_WARN("do rpc processor before_process failed", K(ret));
   } else if (das_remote_info_.need_calc_udf_ &&
       OB_FAIL(GCTX.schema_service_->get_tenant_schema_guard(MTL_ID(), schema_guard_))) {
     LOG_WARN("fail to get schema guard", K(ret));
-  } else if (OB_FAIL(das_factory->create_das_task_result(task.get_task_op()->get_type(),
-                                                         task_result))) {
-    LOG_WARN("create das task result failed", K(ret), K(task));
-  } else if (OB_FAIL(task_result->init(*task.get_task_op()))) {
-    LOG_WARN("init task result failed", K(ret), KPC(task_result), KPC(task.get_task_op()));
-  } else if (OB_FAIL(task_resp.add_op_result(task_result))) {
-    LOG_WARN("failed to add das op result", K(ret), K(*task_result));
-  } else {
+  }
+  //aggregated task arg carries several task ops, each of them has its own task result
+  for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+    ObIDASTaskOp *task_op = task_ops.at(i);
+    ObIDASTaskResult *task_result = nullptr;
+    if (OB_FAIL(das_factory->create_das_task_result(task_op->get_type(), task_result))) {
+      LOG_WARN("create das task result failed", K(ret), K(task));
+    } else if (OB_FAIL(task_result->init(*task_op))) {
+      LOG_WARN("init task result failed", K(ret), KPC(task_result), KPC(task_op));
+    } else if (OB_FAIL(task_resp.add_op_result(task_result))) {
+      LOG_WARN("failed to add das op result", K(ret), K(*task_result));
+    }
+  }
+  if (OB_SUCC(ret)) {
     exec_ctx_.get_sql_ctx()->schema_guard_ = &schema_guard_;
   }
   return ret;
@@ -72,25 +82,55 @@ int ObDASSyncAccessP::process()
   FLTSpanGuard(das_rpc_process);
   ObDASTaskArg &task = arg_;
   ObDASTaskResp &task_resp = result_;
-  ObIDASTaskOp *task_op = task.get_task_op();
-  ObIDASTaskResult *task_result = task_resp.get_op_result();
+  ObIArray<ObIDASTaskOp*> &task_ops = task.get_task_ops();
+  ObIArray<ObIDASTaskResult*> &task_results = task_resp.get_op_results();
+  ObIDASTaskOp *task_op = nullptr;
   bool has_more = false;
   ObDASOpType task_type = DAS_OP_INVALID;
   //regardless of the success of the task execution, the fllowing meta info must be set
-  task_result->set_task_id(task_op->get_task_id());
   task_resp.set_ctrl_svr(task.get_ctrl_svr());
   task_resp.set_runner_svr(task.get_runner_svr());
-  if (OB_ISNULL(task_op) || OB_ISNULL(task_result)) {
+  if (OB_UNLIKELY(task_ops.empty() || task_ops.count() != task_results.count())) {
     ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("task op is nullptr", K(ret), K(task_op), K(task_result));
-  } else if (OB_FAIL(task_op->start_das_task())) {
-    LOG_WARN("start das task failed", K(ret));
-  } else if (OB_FAIL(task_op->fill_task_result(*task_result, has_more))) {
-    LOG_WARN("fill task result to controller failed", K(ret));
-  } else if (OB_UNLIKELY(has_more) && OB_FAIL(task_op->fill_extra_result())) {
-    LOG_WARN("fill extra result to controller failed", KR(ret));
-  } else {
-    task_type = task_op->get_type();
+    LOG_WARN("task op count mismatch", K(ret), K(task_ops.count()), K(task_results.count()));
+  }
+  //aggregated task ops are executed in order and stop at the first failure,
+  //the caller treats the whole RPC as one unit
+  for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+    ObIDASTaskResult *task_result = task_results.at(i);
+    task_op = task_ops.at(i);
+    if (OB_ISNULL(task_op) || OB_ISNULL(task_result)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("task op is nullptr", K(ret), K(task_op), K(task_result));
+    } else {
+      task_result->set_task_id(task_op->get_task_id());
+      if (task_ops.count() > 1 && IS_DAS_DML_OP(*task_op)) {
+        //the aggregated task ops of one DML operator share the deserialized rtdef,
+        //count affected rows from 0 for each of them, so that the task result only
+        //carries the rows of its own op and the scheduler adds them up
+        static_cast<ObDASDMLBaseRtDef*>(task_op->get_rtdef())->affected_rows_ = 0;
+      }
+      if (OB_FAIL(task_op->start_das_task())) {
+        LOG_WARN("start das task failed", K(ret));
+      } else if (OB_FAIL(task_op->fill_task_result(*task_result, has_more))) {
+        LOG_WARN("fill task result to controller failed", K(ret));
+      } else if (OB_UNLIKELY(has_more) && OB_UNLIKELY(task_ops.count() > 1)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("aggregated das task can not have more result", K(ret), KPC(task_op));
+      } else if (OB_UNLIKELY(has_more) && OB_FAIL(task_op->fill_extra_result())) {
+        LOG_WARN("fill extra result to controller failed", KR(ret));
+      } else {
+        task_type = task_op->get_type();
+      }
+      //因为end_task还有可能失败，需要通过RPC将end_task的返回值带回到scheduler上
+      int tmp_ret = task_op->end_das_task();
+      if (OB_SUCCESS != tmp_ret) {
+        LOG_WARN("end das task failed", K(ret), K(tmp_ret), K(task));
+      }
+      ret = COVER_SUCC(tmp_ret);
+    }
+  }
+  if (OB_SUCC(ret)) {
     task_resp.set_has_more(has_more);
     ObWarningBuffer *wb = ob_get_tsi_warning_buffer();
     if (wb != nullptr) {
@@ -98,15 +138,9 @@ int ObDASSyncAccessP::process()
       (void)task_resp.store_warning_msg(*wb);
     }
   }
-  //因为end_task还有可能失败，需要通过RPC将end_task的返回值带回到scheduler上
   if (OB_NOT_NULL(task_op)) {
-    int tmp_ret = task_op->end_das_task();
-    if (OB_SUCCESS != tmp_ret) {
-      LOG_WARN("end das task failed", K(ret), K(tmp_ret), K(task));
-    }
-    ret = COVER_SUCC(tmp_ret);
     if (OB_NOT_NULL(task_op->get_trans_desc())) {
-      tmp_ret = MTL(transaction::ObTransService*)
+      int tmp_ret = MTL(transaction::ObTransService*)
         ->get_tx_exec_result(*task_op->get_trans_desc(),
                             task_resp.get_trans_result());
       if (OB_SUCCESS != tmp_ret) {
@@ -118,14 +152,14 @@ int ObDASSyncAccessP::process()
       ret = GSCHEMASERVICE.is_schema_error_need_retry(NULL, task_op->get_tenant_id()) ?
             OB_ERR_REMOTE_SCHEMA_NOT_FULL : OB_ERR_WAIT_REMOTE_SCHEMA_REFRESH;
     }
-    task_resp.set_err_code(ret);
-    if (OB_SUCCESS != ret) {
-      task_resp.store_err_msg(ob_get_tsi_err_msg(ret));
-      LOG_WARN("process das sync access task failed", K(ret),
-              K(task.get_ctrl_svr()), K(task.get_runner_svr()));
-    }
   }
-  LOG_DEBUG("process das sync access task", K(ret), K(task), KPC(task_result), K(has_more));
+  task_resp.set_err_code(ret);
+  if (OB_SUCCESS != ret) {
+    task_resp.store_err_msg(ob_get_tsi_err_msg(ret));
+    LOG_WARN("process das sync access task failed", K(ret),
+            K(task.get_ctrl_svr()), K(task.get_runner_svr()));
+  }
+  LOG_DEBUG("process das sync access task", K(ret), K(task), K(task_results), K(has_more));
   NG_TRACE_EXT(das_rpc_process_end, OB_ID(type), task_type);
   return OB_SUCCESS;
 }
@@ -302,9 +302,8 @@ OB_DEF_SERIALIZE_SIZE(ObDASTaskArg)
 
 int ObDASTaskArg::add_task_op(ObIDASTaskOp *task_op)
 {
-  // we currently only support single task per ObDASTaskArg.
-  // TODO(roland.qk):remove this assert check after we enable DAS task aggregation.
-  OB_ASSERT(task_ops_.count() == 0);
+  // remote DML tasks to the same server may be aggregated into one ObDASTaskArg,
+  // see ObDASRef::execute_all_task()
   return task_ops_.push_back(task_op);
 }
 
@@ -424,9 +423,7 @@ OB_DEF_SERIALIZE_SIZE(ObDASTaskResp)
 
 int ObDASTaskResp::add_op_result(ObIDASTaskResult *op_result)
 {
-  // we currently only support single task per ObDASTaskResp.
-  // TODO(roland.qk):remove this assert check after we enable DAS task aggregation.
-  OB_ASSERT(op_results_.count() == 0);
+  // one op result per task op in ObDASTaskArg, in the same order
   return op_results_.push_back(op_result);
 }
 
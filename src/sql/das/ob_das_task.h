@@ -277,6 +277,7 @@ public:
 
   int add_task_op(ObIDASTaskOp *task_op);
   ObIDASTaskOp *get_task_op();
+  common::ObIArray<ObIDASTaskOp*> &get_task_ops() { return task_ops_; }
   void set_remote_info(ObDASRemoteInfo *remote_info) { remote_info_ = remote_info; }
   ObDASRemoteInfo *get_remote_info() { return remote_info_; }
   common::ObAddr &get_runner_svr() { return runner_svr_; }
@@ -305,6 +306,7 @@ public:
   ObDASTaskResp();
   int add_op_result(ObIDASTaskResult *op_result);
   ObIDASTaskResult *get_op_result();
+  common::ObIArray<ObIDASTaskResult*> &get_op_results() { return op_results_; }
   void set_err_code(int err_code) { rcode_.rcode_ = err_code; }
   int get_err_code() const { return rcode_.rcode_; }
   const obrpc::ObRpcResultCode &get_rcode() const { return rcode_; }
@@ -132,6 +132,33 @@ int ObDataAccessService::get_das_task_id(int64_t &das_id)
   return ret;
 }
 
+int ObDataAccessService::execute_aggregated_das_task(ObDASRef &das_ref,
+                                                     ObIArray<ObIDASTaskOp*> &task_ops)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = das_ref.get_exec_ctx().get_my_session();
+  ObDASTaskArg task_arg;
+  if (OB_UNLIKELY(task_ops.empty())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(task_ops.count()));
+  } else if (OB_FAIL(append(task_arg.get_task_ops(), task_ops))) {
+    LOG_WARN("failed to add das task ops", K(ret), K(task_ops.count()));
+  } else {
+    task_arg.set_timeout_ts(session->get_query_timeout_ts());
+    task_arg.set_ctrl_svr(ctrl_addr_);
+    task_arg.get_runner_svr() = task_ops.at(0)->tablet_loc_->server_;
+    if (OB_FAIL(do_remote_das_task(das_ref, task_arg))) {
+      LOG_WARN("do remote aggregated das task failed", K(ret), K(task_ops.count()),
+               K(task_arg.get_runner_svr()));
+    }
+  }
+  //the aggregated task ops succeed or fail as a whole
+  for (int64_t i = 0; i < task_ops.count(); ++i) {
+    task_ops.at(i)->errcode_ = ret;
+  }
+  return ret;
+}
+
 OB_NOINLINE int ObDataAccessService::execute_dist_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op)
 {
   int ret = OB_SUCCESS;
@@ -294,31 +321,42 @@ int ObDataAccessService::do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &tas
   ObPhysicalPlanCtx *plan_ctx = das_ref.get_exec_ctx().get_physical_plan_ctx();
   int64_t timeout = plan_ctx->get_timeout_timestamp() - ObTimeUtility::current_time();
   uint64_t tenant_id = session->get_rpc_tenant_id();
-  ObIDASTaskOp *task_op = task_arg.get_task_op();
-  ObIDASTaskResult *op_result = nullptr;
+  ObIArray<ObIDASTaskOp*> &task_ops = task_arg.get_task_ops();
   ObDASExtraData *extra_result = nullptr;
   ObDASRemoteInfo remote_info;
   remote_info.exec_ctx_ = &das_ref.get_exec_ctx();
   remote_info.frame_info_ = das_ref.get_expr_frame_info();
   remote_info.trans_desc_ = session->get_tx_desc();
-  remote_info.snapshot_ = *task_op->get_snapshot();
   remote_info.need_tx_ = (remote_info.trans_desc_ != nullptr);
   task_arg.set_remote_info(&remote_info);
   ObDASRemoteInfo::get_remote_info() = &remote_info;
 
   LOG_DEBUG("begin to do remote das task", K(task_arg));
   SMART_VAR(ObDASTaskResp, task_resp) {
-    if (OB_FAIL(collect_das_task_info(task_arg, remote_info))) {
+    if (OB_UNLIKELY(task_ops.empty())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("no das task op in task arg", K(ret), K(task_arg));
+    } else if (OB_FAIL(collect_das_task_info(task_arg, remote_info))) {
       LOG_WARN("collect das task info failed", K(ret));
-    } else if (OB_FAIL(das_ref.get_das_factory().create_das_task_result(task_op->get_type(), op_result))) {
-      LOG_WARN("create das task result failed", K(ret));
-    } else if (OB_FAIL(op_result->init(*task_op))) {
-      LOG_WARN("init task result failed", K(ret));
+    } else {
+      //all task ops in one task arg share the same snapshot, see ObDASRef::execute_all_task()
+      remote_info.snapshot_ = *task_ops.at(0)->get_snapshot();
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+      ObIDASTaskOp *task_op = task_ops.at(i);
+      ObIDASTaskResult *op_result = nullptr;
+      if (OB_FAIL(das_ref.get_das_factory().create_das_task_result(task_op->get_type(), op_result))) {
+        LOG_WARN("create das task result failed", K(ret));
+      } else if (OB_FAIL(op_result->init(*task_op))) {
+        LOG_WARN("init task result failed", K(ret));
+      } else if (OB_FAIL(task_resp.add_op_result(op_result))) {
+        LOG_WARN("failed to add op result", K(ret));
+      }
+    }
+    if (OB_FAIL(ret)) {
     } else if (OB_UNLIKELY(timeout <= 0)) {
       ret = OB_TIMEOUT;
       LOG_WARN("das is timeout", K(ret), K(plan_ctx->get_timeout_timestamp()), K(timeout));
-    } else if (OB_FAIL(task_resp.add_op_result(op_result))) {
-      LOG_WARN("failed to add op result", K(ret));
     } else if (OB_FAIL(das_rpc_proxy_
                     .to(task_arg.get_runner_svr())
                     .by(tenant_id)
@@ -327,18 +365,33 @@ int ObDataAccessService::do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &tas
       LOG_WARN("rpc remote sync access failed", K(ret), K(task_arg));
       // RPC fail, add task's LSID to trans_result
       // indicate some transaction participant may touched
-      session->get_trans_result().add_touched_ls(task_op->get_ls_id());
+      for (int64_t i = 0; i < task_ops.count(); ++i) {
+        session->get_trans_result().add_touched_ls(task_ops.at(i)->get_ls_id());
+      }
     } else {
+      ObIArray<ObIDASTaskResult*> &op_results = task_resp.get_op_results();
       ObDASUtils::log_user_error_and_warn(task_resp.get_rcode());
       if (OB_FAIL(task_resp.get_err_code())) {
         LOG_WARN("error occurring in remote das task", K(ret), K(task_arg));
-      } else if (OB_FAIL(task_op->decode_task_result(op_result))) {
-        LOG_WARN("decode das task result failed", K(ret));
+      } else if (OB_UNLIKELY(op_results.count() != task_ops.count())) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("das op result count mismatch", K(ret), K(op_results.count()), K(task_ops.count()));
+      } else if (OB_UNLIKELY(task_resp.has_more() && task_ops.count() > 1)) {
+        //only single task op can leave its result on the runner
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("aggregated das task has more result", K(ret), K(task_ops.count()));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+        if (OB_FAIL(task_ops.at(i)->decode_task_result(op_results.at(i)))) {
+          LOG_WARN("decode das task result failed", K(ret));
+        }
+      }
+      if (OB_FAIL(ret)) {
       } else if (task_resp.has_more()
                   && OB_FAIL(setup_extra_result(das_ref, task_resp,
-                  task_op, extra_result))) {
+                  task_ops.at(0), extra_result))) {
         LOG_WARN("setup extra result failed", KR(ret));
-      } else if (task_resp.has_more() && OB_FAIL(op_result->link_extra_result(*extra_result))) {
+      } else if (task_resp.has_more() && OB_FAIL(op_results.at(0)->link_extra_result(*extra_result))) {
         LOG_WARN("link extra result failed", K(ret));
       }
       if (OB_NOT_NULL(session->get_tx_desc())) {
@@ -359,25 +412,28 @@ int ObDataAccessService::do_remote_das_task(ObDASRef &das_ref, ObDASTaskArg &tas
 int ObDataAccessService::collect_das_task_info(ObDASTaskArg &task_arg, ObDASRemoteInfo &remote_info)
 {
   int ret = OB_SUCCESS;
-  ObIDASTaskOp *task_op = task_arg.get_task_op();
-  if (task_op->get_ctdef() != nullptr) {
-    remote_info.has_expr_ |= task_op->get_ctdef()->has_expr();
-    remote_info.need_calc_expr_ |= task_op->get_ctdef()->has_pdfilter_or_calc_expr();
-    remote_info.need_calc_udf_ |= task_op->get_ctdef()->has_pl_udf();
-    if (OB_FAIL(add_var_to_array_no_dup(remote_info.ctdefs_, task_op->get_ctdef()))) {
-      LOG_WARN("store remote ctdef failed", K(ret));
+  ObIArray<ObIDASTaskOp*> &task_ops = task_arg.get_task_ops();
+  for (int64_t i = 0; OB_SUCC(ret) && i < task_ops.count(); ++i) {
+    ObIDASTaskOp *task_op = task_ops.at(i);
+    if (task_op->get_ctdef() != nullptr) {
+      remote_info.has_expr_ |= task_op->get_ctdef()->has_expr();
+      remote_info.need_calc_expr_ |= task_op->get_ctdef()->has_pdfilter_or_calc_expr();
+      remote_info.need_calc_udf_ |= task_op->get_ctdef()->has_pl_udf();
+      if (OB_FAIL(add_var_to_array_no_dup(remote_info.ctdefs_, task_op->get_ctdef()))) {
+        LOG_WARN("store remote ctdef failed", K(ret));
+      }
     }
-  }
-  if (OB_SUCC(ret) && task_op->get_rtdef() != nullptr) {
-    if (OB_FAIL(add_var_to_array_no_dup(remote_info.rtdefs_, task_op->get_rtdef()))) {
-      LOG_WARN("store remote rtdef failed", K(ret));
+    if (OB_SUCC(ret) && task_op->get_rtdef() != nullptr) {
+      if (OB_FAIL(add_var_to_array_no_dup(remote_info.rtdefs_, task_op->get_rtdef()))) {
+        LOG_WARN("store remote rtdef failed", K(ret));
+      }
     }
-  }
-  if (OB_SUCC(ret)) {
-    if (OB_FAIL(append_array_no_dup(remote_info.ctdefs_, task_op->get_related_ctdefs()))) {
-      LOG_WARN("append task op related ctdefs to remote info failed", K(ret));
-    } else if (OB_FAIL(append_array_no_dup(remote_info.rtdefs_, task_op->get_related_rtdefs()))) {
-      LOG_WARN("append task op related rtdefs to remote info failed", K(ret));
+    if (OB_SUCC(ret)) {
+      if (OB_FAIL(append_array_no_dup(remote_info.ctdefs_, task_op->get_related_ctdefs()))) {
+        LOG_WARN("append task op related ctdefs to remote info failed", K(ret));
+      } else if (OB_FAIL(append_array_no_dup(remote_info.rtdefs_, task_op->get_related_rtdefs()))) {
+        LOG_WARN("append task op related rtdefs to remote info failed", K(ret));
+      }
     }
   }
   return ret;
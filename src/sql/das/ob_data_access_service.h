@@ -39,6 +39,8 @@ public:
            const common::ObAddr &self_addr);
   //开启DAS Task分区相关的事务控制，并执行task对应的op
   int execute_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
+  //将发往同一个远端server的多个DML DAS Task合并到一个RPC中执行
+  int execute_aggregated_das_task(ObDASRef &das_ref, common::ObIArray<ObIDASTaskOp*> &task_ops);
   //关闭DAS Task的执行流程，并释放task持有的资源，并结束相关的事务控制
   int end_das_task(ObDASRef &das_ref, ObIDASTaskOp &task_op);
   int get_das_task_id(int64_t &das_id);
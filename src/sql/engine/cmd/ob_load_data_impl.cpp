@@ -1918,18 +1918,29 @@ int ObLoadDataSPImpl::execute(ObExecContext &ctx, ObLoadDataStmt &load_stmt)
     }
 
     //main while
-    while (OB_SUCC(ret) && !box.read_cursor.is_end_file()) {
+    bool shuffle_in_flight = false;
+    if (OB_SUCC(ret) && !box.read_cursor.is_end_file()) {
+      shuffle_in_flight = true;
+      OZ (shuffle_task_gen_and_dispatch(ctx, box));
+    }
+    while (OB_SUCC(ret) && shuffle_in_flight) {
       /* 执行分两步并行
        * 1. 并行计算分区 (shuffle_task_gen_and_dispatch)
        * 2. 并行插入 (insert_task_gen_and_dispatch)
        * 每次循环从文件读取 data_frag_mem_usage_limit * MAX_BUFFER_SIZE = 100M 在内存缓存
+       * 插入本轮数据之前先派发下一轮的shuffle task, 使读文件和解析与插入重叠,
+       * 内存中最多缓存两轮的数据
        */
-      OZ (shuffle_task_gen_and_dispatch(ctx, box));
+      shuffle_in_flight = false;
       OW (wait_shuffle_task_return(box));
+      if (OB_SUCC(ret) && !box.read_cursor.is_end_file()) {
+        shuffle_in_flight = true;
+        OZ (shuffle_task_gen_and_dispatch(ctx, box));
+      }
       OZ (insert_task_gen_and_dispatch(ctx, box));
       //OW (wait_insert_task_return(ctx, box));
 
-      /* 所有异步task都已经返回了，这些task依赖的datafrag可以被释放
+      /* 所有异步insert task都已经返回了，这些task依赖的datafrag可以被释放
        */
       OW (box.data_frag_mgr.free_unused_datafrag());
 
@@ -1937,6 +1948,10 @@ int ObLoadDataSPImpl::execute(ObExecContext &ctx, ObLoadDataStmt &load_stmt)
        */
       OZ (ObLoadDataUtils::check_session_status(*ctx.get_my_session()));
     }
+    if (shuffle_in_flight) {
+      // shuffle tasks of the prefetched round may still write to data_frag_mgr
+      OW (wait_shuffle_task_return(box));
+    }
 
     //release
     OW (box.release_resources());
@@ -2247,7 +2262,7 @@ void ObDataFragMgr::distory_datafrag(ObDataFrag *frag) {
   } else {
     frag->~ObDataFrag();
     ob_free(frag);
-    total_free_cnt_++;
+    ATOMIC_INC(&total_free_cnt_);
   }
 }
 
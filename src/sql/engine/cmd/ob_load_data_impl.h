@@ -234,7 +234,7 @@ public:
   common::ObIArray<ObTabletID> &get_tablet_ids() { return tablet_ids_; }
   const common::ObBitSet<> &get_part_bitset() { return part_bitset_; }
   int64_t get_total_allocated_frag_count() const { return ATOMIC_LOAD(&total_alloc_cnt_); }
-  int64_t get_total_freed_frag_count() const { return total_free_cnt_; }
+  int64_t get_total_freed_frag_count() const { return ATOMIC_LOAD(&total_free_cnt_); }
   TO_STRING_KV(K_(total_part_cnt),
                "total_alloc_cnt", get_total_allocated_frag_count(),
                K_(total_free_cnt));
@@ -243,7 +243,7 @@ private:
   common::ObMemAttr attr_;
   int64_t total_part_cnt_;
   volatile int64_t total_alloc_cnt_;
-  int64_t total_free_cnt_;
+  volatile int64_t total_free_cnt_;
   common::ObSEArray<ObTabletID, 64> tablet_ids_;
   common::ObBitSet<> part_bitset_;
 
@@ -61,6 +61,13 @@ int ObExprJoinFilter::calc_result_typeN(ObExprResType& type,
   return ret;
 }
 
+bool ObExprJoinFilter::is_int_range_usable(const ObExpr &expr, const ObPxBloomFilter &filter)
+{
+  return 1 == expr.arg_cnt_
+      && ObIntTC == ob_obj_type_class(expr.args_[0]->datum_meta_.type_)
+      && filter.has_int_range();
+}
+
 int ObExprJoinFilter::eval_bloom_filter(const ObExpr &expr, ObEvalCtx &ctx,
                                         ObDatum &res)
 {
@@ -123,7 +130,12 @@ int ObExprJoinFilter::eval_bloom_filter(const ObExpr &expr, ObEvalCtx &ctx,
             hash_val = hash_func.hash_func_(*datum, hash_val);
           }
         }
-        if (OB_SUCC(ret)) {
+        if (OB_FAIL(ret)) {
+        } else if (is_int_range_usable(expr, *bloom_filter_ptr_) && !datum->is_null()
+                   && bloom_filter_ptr_->is_out_of_int_range(datum->get_int())) {
+          is_match = false;
+          join_filter_ctx->check_count_++;
+        } else {
           if (OB_FAIL(bloom_filter_ptr_->might_contain(hash_val, is_match))) {
             LOG_WARN("fail to check filter might contain value", K(ret), K(hash_val));
           } else {
@@ -229,7 +241,29 @@ int ObExprJoinFilter::eval_bloom_filter_batch(
             }
           }
         }
-        if (OB_FAIL(ObBitVector::flip_foreach(skip, batch_size,
+        if (OB_FAIL(ret)) {
+        } else if (is_int_range_usable(expr, *bloom_filter_ptr_)) {
+          // values out of the build side key range are rejected without probing the bits
+          const ObDatum *datums = expr.args_[0]->locate_batch_datums(ctx);
+          const bool is_batch = expr.args_[0]->is_batch_result();
+          if (OB_FAIL(ObBitVector::flip_foreach(skip, batch_size,
+              [&](int64_t idx) __attribute__((always_inline)) {
+                const ObDatum &datum = datums[is_batch ? idx : 0];
+                if (!datum.is_null() && bloom_filter_ptr_->is_out_of_int_range(datum.get_int())) {
+                  is_match = false;
+                } else {
+                  ret = bloom_filter_ptr_->might_contain(hash_values[idx], is_match);
+                }
+                ++join_filter_ctx->check_count_;
+                ++join_filter_ctx->total_count_;
+                join_filter_ctx->filter_count_ += !is_match;
+                eval_flags.set(idx);
+                results[idx].set_int(is_match);
+                return ret;
+              }))) {
+            LOG_WARN("failed to check join filter with key range", K(ret));
+          }
+        } else if (OB_FAIL(ObBitVector::flip_foreach(skip, batch_size,
               [&](int64_t idx) __attribute__((always_inline)) {
                 bloom_filter_ptr_->prefetch_bits_block(hash_values[idx]); return OB_SUCCESS;
               }))) {
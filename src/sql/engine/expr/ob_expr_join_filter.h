@@ -56,6 +56,7 @@ public:
   // hard code seed, 32 bit max prime number
   static const int64_t JOIN_FILTER_SEED = 4294967279;
 private:
+  static bool is_int_range_usable(const ObExpr &expr, const ObPxBloomFilter &filter);
   static const int64_t CHECK_TIMES = 127;
   DISALLOW_COPY_AND_ASSIGN(ObExprJoinFilter);
 };
@@ -231,6 +231,9 @@ int ObJoinFilterOp::inner_open()
       ret = OB_NOT_INIT;
       LOG_WARN("the bloom filter is not init", K(ret));
     }
+    if (OB_SUCC(ret) && is_int_range_key()) {
+      filter_create_->enable_int_range();
+    }
     if (OB_SUCC(ret) && MY_SPEC.max_batch_size_ > 0) {
       if (OB_ISNULL(batch_hash_values_ =
               (uint64_t *)ctx_.get_allocator().alloc(sizeof(uint64_t) * MY_SPEC.max_batch_size_))) {
@@ -278,6 +281,9 @@ int ObJoinFilterOp::do_create_filter_rescan()
     LOG_WARN("filter create is unexpected", K(ret));
   } else {
     filter_create_->reset_filter();
+    if (is_int_range_key()) {
+      filter_create_->enable_int_range();
+    }
   }
   return ret;
 }
@@ -568,6 +574,16 @@ int ObJoinFilterOp::calc_hash_value(uint64_t &hash_value, bool &ignore)
   return ret;
 }
 
+// a single integer join key also maintains the value range of the build side,
+// use side rejects probe values out of the range before probing the bits.
+bool ObJoinFilterOp::is_int_range_key() const
+{
+  return !MY_SPEC.is_partition_filter()
+      && 1 == MY_SPEC.join_keys_.count()
+      && OB_NOT_NULL(MY_SPEC.join_keys_.at(0))
+      && ObIntTC == ob_obj_type_class(MY_SPEC.join_keys_.at(0)->datum_meta_.type_);
+}
+
 int ObJoinFilterOp::insert_by_row()
 {
   int ret = OB_SUCCESS;
@@ -579,6 +595,12 @@ int ObJoinFilterOp::insert_by_row()
     /*do nothing*/
   } else if (OB_FAIL(filter_create_->put(hash_value))) {
     LOG_WARN("fail to put  hash value to px bloom filter", K(ret));
+  } else if (filter_create_->has_int_range()) {
+    // the key datum has been evaluated by calc_hash_value
+    const ObDatum &datum = MY_SPEC.join_keys_.at(0)->locate_expr_datum(eval_ctx_);
+    if (!datum.is_null()) {
+      filter_create_->update_int_range(datum.get_int(), datum.get_int());
+    }
   }
   return ret;
 }
@@ -635,6 +657,27 @@ int ObJoinFilterOp::insert_by_row_batch(const ObBatchRows *child_brs)
         }
       }
     }
+    if (OB_SUCC(ret) && filter_create_->has_int_range()) {
+      ObExpr *expr = MY_SPEC.join_keys_.at(0);
+      const ObDatum *datums = expr->locate_batch_datums(eval_ctx_);
+      const bool is_batch = expr->is_batch_result();
+      int64_t min_val = INT64_MAX;
+      int64_t max_val = INT64_MIN;
+      for (int64_t i = 0; i < child_brs->size_; ++i) {
+        if (child_brs->skip_->at(i)) {
+          continue;
+        } else {
+          const ObDatum &datum = datums[is_batch ? i : 0];
+          if (!datum.is_null()) {
+            min_val = std::min(min_val, datum.get_int());
+            max_val = std::max(max_val, datum.get_int());
+          }
+        }
+      }
+      if (min_val <= max_val) {
+        filter_create_->update_int_range(min_val, max_val);
+      }
+    }
   }
   return ret;
 }
@@ -151,6 +151,7 @@ private:
   int insert_by_row();
   int insert_by_row_batch(const ObBatchRows *child_brs);
   int check_contain_row(bool &match);
+  bool is_int_range_key() const;
   int calc_hash_value(uint64_t &hash_value, bool &ignore);
   int calc_hash_value(uint64_t &hash_value);
   int do_create_filter_rescan();
@@ -299,10 +299,13 @@ int ObNestedLoopJoinOp::join_row_with_semi_join()
 {
   int ret = OB_SUCCESS;
   const bool is_anti = (LEFT_ANTI_JOIN == MY_SPEC.join_type_);
-  while (OB_SUCC(ret) && OB_SUCC(get_next_left_row())) {
+  while (OB_SUCC(ret)
+         && OB_SUCC(MY_SPEC.use_group_ ? group_read_left_operate() : get_next_left_row())) {
     clear_evaluated_flag();
     if (OB_FAIL(try_check_status())) {
       LOG_WARN("check status failed", K(ret));
+    } else if (MY_SPEC.use_group_) {
+      // right child has been switched to the group of current left row
     } else if (OB_FAIL(prepare_rescan_params())) {
       LOG_WARN("prepare right child rescan param failed", K(ret));
     } else if (OB_FAIL(rescan_right_operator())) {
@@ -321,6 +324,11 @@ int ObNestedLoopJoinOp::join_row_with_semi_join()
           LOG_WARN("calc other conditions failed", K(ret));
         }
       }
+      if (OB_SUCC(ret) && is_matched && MY_SPEC.use_group_) {
+        if (OB_FAIL(drain_right_group())) {
+          LOG_WARN("drain right group failed", K(ret));
+        }
+      }
       if (OB_ITER_END == ret) {
         ret = OB_SUCCESS; // 右表不存在和左表匹配的行，所以迭代左表下一行
       }
@@ -343,6 +351,34 @@ int ObNestedLoopJoinOp::join_row_with_semi_join()
   return ret;
 }
 
+// In group rescan, rows of all left rows are returned by one right iterator and the
+// group is only switched correctly after the current group reaches its end, so semi/anti
+// join which stops at the first match must consume the rest rows of the group.
+int ObNestedLoopJoinOp::drain_right_group()
+{
+  int ret = OB_SUCCESS;
+  if (is_vectorized()) {
+    const ObBatchRows *right_brs = &right_->get_brs();
+    while (OB_SUCC(ret) && !right_brs->end_) {
+      if (OB_FAIL(right_->get_next_batch(op_max_batch_size_, right_brs))) {
+        LOG_WARN("fail to get next right batch", K(ret));
+      }
+    }
+  } else {
+    while (OB_SUCC(ret)) {
+      if (OB_FAIL(right_->get_next_row())) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("fail to get next right row", K(ret));
+        }
+      }
+    }
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    }
+  }
+  return ret;
+}
+
 int ObNestedLoopJoinOp::join_end_operate()
 {
   return OB_ITER_END;
@@ -922,6 +958,13 @@ int ObNestedLoopJoinOp::process_left_batch()
       reset_batchrows();
     } // while right batch end
 
+    if (OB_SUCC(ret) && MY_SPEC.use_group_ && IS_LEFT_SEMI_ANTI_JOIN(MY_SPEC.join_type_)
+        && !right_->get_brs().end_) {
+      if (OB_FAIL(drain_right_group())) {
+        LOG_WARN("drain right group failed", K(ret));
+      }
+    }
+
     if (MY_SPEC.enable_px_batch_rescan_) {
       batch_rescan_ctl_.cur_idx_++;
     }
@@ -182,6 +182,7 @@ private:
   int read_right_func_going();
   int read_right_func_end();
   int rescan_right_operator();
+  int drain_right_group();
   // state operations and transfer functions array.
   state_operation_func_type state_operation_func_[JS_STATE_COUNT];
   state_function_func_type state_function_func_[JS_STATE_COUNT][FT_TYPE_COUNT];
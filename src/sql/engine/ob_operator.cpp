@@ -1144,6 +1144,101 @@ int ObOperator::filter(const common::ObIArray<ObExpr *> &exprs, bool &filtered)
   return filter_row(eval_ctx_, exprs, filtered);
 }
 
+// Filter `a <cmp> b` where a and b are leaf exprs (column, param or const) of int type class,
+// is evaluated in one fused loop on raw int64 values, and the compare result datums are
+// never materialized. The compare expr itself is not marked evaluated, so any other
+// reference to it still goes through the normal eval path.
+// IS_BASIC_CMP_OP does not cover T_OP_NE, so `!=` is listed explicitly.
+bool ObOperator::is_fused_int_cmp_filter(const ObExpr &e)
+{
+  bool fused = false;
+  if (2 == e.arg_cnt_
+      && (IS_BASIC_CMP_OP(e.type_) || T_OP_NE == e.type_)
+      && T_OP_LIKE != e.type_ && T_OP_NSEQ != e.type_) {
+    const ObExpr *l = e.args_[0];
+    const ObExpr *r = e.args_[1];
+    fused = OB_NOT_NULL(l) && OB_NOT_NULL(r)
+        && 0 == l->arg_cnt_ && 0 == r->arg_cnt_
+        && ObIntTC == ob_obj_type_class(l->datum_meta_.type_)
+        && ObIntTC == ob_obj_type_class(r->datum_meta_.type_);
+  }
+  return fused;
+}
+
+template <ObItemType CMP_TYPE>
+static OB_INLINE bool fused_int_cmp(const int64_t l, const int64_t r)
+{
+  return T_OP_EQ == CMP_TYPE ? l == r
+      : T_OP_NE == CMP_TYPE ? l != r
+      : T_OP_LT == CMP_TYPE ? l < r
+      : T_OP_LE == CMP_TYPE ? l <= r
+      : T_OP_GT == CMP_TYPE ? l > r
+      : l >= r;
+}
+
+template <ObItemType CMP_TYPE>
+static int64_t fused_int_cmp_filter(const ObDatum *l_datums,
+                                    const bool l_batch,
+                                    const ObDatum *r_datums,
+                                    const bool r_batch,
+                                    ObBitVector &skip,
+                                    const int64_t bsize)
+{
+  int64_t output_rows = 0;
+  for (int64_t i = 0; i < bsize; i++) {
+    if (!skip.at(i)) {
+      const ObDatum &l = l_datums[l_batch ? i : 0];
+      const ObDatum &r = r_datums[r_batch ? i : 0];
+      if (l.null_ || r.null_ || !fused_int_cmp<CMP_TYPE>(*l.int_, *r.int_)) {
+        skip.set(i);
+      } else {
+        output_rows += 1;
+      }
+    }
+  }
+  return output_rows;
+}
+
+int ObOperator::eval_fused_int_cmp_filter(const ObExpr &e,
+                                          ObEvalCtx &eval_ctx,
+                                          ObBitVector &skip,
+                                          const int64_t bsize,
+                                          bool &all_filtered)
+{
+  int ret = OB_SUCCESS;
+  const ObExpr &l = *e.args_[0];
+  const ObExpr &r = *e.args_[1];
+  if (OB_FAIL(l.eval_batch(eval_ctx, skip, bsize))) {
+    LOG_WARN("evaluate batch failed", K(ret), K(l));
+  } else if (OB_FAIL(r.eval_batch(eval_ctx, skip, bsize))) {
+    LOG_WARN("evaluate batch failed", K(ret), K(r));
+  } else {
+    const bool l_batch = l.is_batch_result();
+    const bool r_batch = r.is_batch_result();
+    const ObDatum *l_datums = l_batch ? l.locate_batch_datums(eval_ctx) : &l.locate_expr_datum(eval_ctx);
+    const ObDatum *r_datums = r_batch ? r.locate_batch_datums(eval_ctx) : &r.locate_expr_datum(eval_ctx);
+    int64_t output_rows = 0;
+#define FUSED_INT_CMP_CASE(CMP_TYPE) \
+    case CMP_TYPE: \
+      output_rows = fused_int_cmp_filter<CMP_TYPE>(l_datums, l_batch, r_datums, r_batch, skip, bsize); \
+      break;
+    switch (e.type_) {
+      FUSED_INT_CMP_CASE(T_OP_EQ)
+      FUSED_INT_CMP_CASE(T_OP_NE)
+      FUSED_INT_CMP_CASE(T_OP_LT)
+      FUSED_INT_CMP_CASE(T_OP_LE)
+      FUSED_INT_CMP_CASE(T_OP_GT)
+      FUSED_INT_CMP_CASE(T_OP_GE)
+      default:
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected compare type", K(ret), K(e.type_));
+    }
+#undef FUSED_INT_CMP_CASE
+    all_filtered = (0 == output_rows);
+  }
+  return ret;
+}
+
 int ObOperator::filter_batch_rows(const ObExprPtrIArray &exprs,
                                   ObBitVector &skip,
                                   const int64_t bsize,
@@ -1153,7 +1248,11 @@ int ObOperator::filter_batch_rows(const ObExprPtrIArray &exprs,
   all_filtered = false;
   FOREACH_CNT_X(e, exprs, OB_SUCC(ret) && !all_filtered) {
     OB_ASSERT(ob_is_int_tc((*e)->datum_meta_.type_));
-    if (OB_FAIL((*e)->eval_batch(eval_ctx_, skip, bsize))) {
+    if (is_fused_int_cmp_filter(**e)) {
+      if (OB_FAIL(eval_fused_int_cmp_filter(**e, eval_ctx_, skip, bsize, all_filtered))) {
+        LOG_WARN("evaluate fused filter failed", K(ret), K_(eval_ctx));
+      }
+    } else if (OB_FAIL((*e)->eval_batch(eval_ctx_, skip, bsize))) {
       LOG_WARN("evaluate batch failed", K(ret), K_(eval_ctx));
     } else if (!(*e)->is_batch_result()) {
       const ObDatum &d = (*e)->locate_expr_datum(eval_ctx_);
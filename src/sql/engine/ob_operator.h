@@ -493,6 +493,15 @@ public:
   static int filter_row(ObEvalCtx &eval_ctx,
                         const common::ObIArray<ObExpr *> &exprs,
                         bool &filtered);
+  // Whether the batch filter `e` can be evaluated by eval_fused_int_cmp_filter().
+  static bool is_fused_int_cmp_filter(const ObExpr &e);
+  // Evaluate an int compare filter in one loop and set the filtered rows in %skip,
+  // same result as evaluating `e` and filtering NULL and zero.
+  static int eval_fused_int_cmp_filter(const ObExpr &e,
+                                       ObEvalCtx &eval_ctx,
+                                       ObBitVector &skip,
+                                       const int64_t bsize,
+                                       bool &all_filtered);
   ObBatchRows &get_brs() { return brs_; }
   // Drain exchange in data for PX, or producer DFO will be blocked.
   virtual int drain_exch();
@@ -651,7 +651,8 @@ int ObGranuleSplitter::split_gi_task(ObGranulePumpArgs &args,
                                      const common::ObIArray<ObDASTabletLoc*> &tablets,
                                      bool partition_granule,
                                      ObGITaskSet &task_set,
-                                     ObGITaskSet::ObGIRandomType random_type)
+                                     ObGITaskSet::ObGIRandomType random_type,
+                                     bool large_partition_first)
 {
   int ret = OB_SUCCESS;
   ObSEArray<ObNewRange, 16> ranges;
@@ -683,7 +684,8 @@ int ObGranuleSplitter::split_gi_task(ObGranulePumpArgs &args,
                                                        taskset_tablets,
                                                        taskset_ranges,
                                                        taskset_idxs,
-                                                       range_independent))) {
+                                                       range_independent,
+                                                       large_partition_first))) {
     LOG_WARN("failed to get graunle task", K(ret), K(ranges), K(tablets));
   } else if (OB_FAIL(task_set.construct_taskset(taskset_tablets, taskset_ranges, taskset_idxs, random_type))) {
     LOG_WARN("construct taskset failed", K(ret), K(taskset_tablets),
@@ -825,6 +827,12 @@ int ObRandomGranuleSplitter::split_granule(ObGranulePumpArgs &args,
       ObGITaskSet total_task_set;
       ObGITaskArray &taskset_array = gi_task_array_result.at(idx).taskset_array_;
       partition_granule = is_virtual_table(scan_key_id) || partition_granule;
+      // tasks of the shared pool are fetched in order, so without an order requirement
+      // the partition granules can be handed out from the largest one
+      bool large_partition_first = !is_virtual_table(scan_key_id)
+                                   && ObGITaskSet::GI_RANDOM_NONE == random_type
+                                   && !args.asc_order()
+                                   && !args.desc_order();
       if (OB_FAIL(split_gi_task(args,
                                          tsc,
                                          scan_key_id,
@@ -832,7 +840,8 @@ int ObRandomGranuleSplitter::split_granule(ObGranulePumpArgs &args,
                                          tablet_arrays.at(idx),
                                          partition_granule,
                                          total_task_set,
-                                         random_type))) {
+                                         random_type,
+                                         large_partition_first))) {
         LOG_WARN("failed to init granule iter pump", K(ret), K(idx), K(tablet_arrays));
       } else if (OB_FAIL(total_task_set.set_block_order(args.desc_order()))) {
         LOG_WARN("fail set block order", K(ret));
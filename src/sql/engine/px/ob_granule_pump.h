@@ -182,7 +182,8 @@ protected :
                     const common::ObIArray<ObDASTabletLoc*> &tablets,
                     bool partition_granule,
                     ObGITaskSet &task_set,
-                    ObGITaskSet::ObGIRandomType random_type);
+                    ObGITaskSet::ObGIRandomType random_type,
+                    bool large_partition_first = false);
 
 public :
   ObSEArray<ObPxTabletInfo, 8> partitions_info_;
@@ -80,7 +80,8 @@ int ObGranuleUtil::split_block_ranges(ObIAllocator &allocator,
                                       common::ObIArray<ObDASTabletLoc*> &granule_tablets,
                                       common::ObIArray<common::ObNewRange> &granule_ranges,
                                       common::ObIArray<int64_t> &granule_idx,
-                                      bool range_independent)
+                                      bool range_independent,
+                                      bool large_partition_first)
 {
   int ret = OB_SUCCESS;
   int64_t total_macros_count = 0;
@@ -105,7 +106,19 @@ int ObGranuleUtil::split_block_ranges(ObIAllocator &allocator,
     // partition granule iterator
     // 按照partition粒度切分任务的情况下，任务的个数等于partition的个数（`tablets.count()`)
     int64_t pk_idx = 0;
-    FOREACH_CNT_X(tablet, tablets, OB_SUCC(ret)) {
+    DASTabletLocSEArray sorted_tablets;
+    const ObIArray<ObDASTabletLoc*> *granule_source = &tablets;
+    // workers fetch partition granules one by one from the shared pool, if a large partition
+    // is left to the end, the whole query waits for the only worker scanning it. handing out
+    // the large partitions first lets the small ones fill in the gaps of the other workers.
+    if (large_partition_first && !only_empty_range && tablets.count() > parallelism) {
+      if (OB_FAIL(sort_tablets_by_size(allocator, tsc, ranges, tablets, sorted_tablets))) {
+        LOG_WARN("failed to sort tablets by size", K(ret));
+      } else {
+        granule_source = &sorted_tablets;
+      }
+    }
+    FOREACH_CNT_X(tablet, *granule_source, OB_SUCC(ret)) {
       FOREACH_CNT_X(range, ranges, OB_SUCC(ret)) {
         if (OB_FAIL(granule_tablets.push_back(*tablet))) {
           LOG_WARN("push basck tablet failed", K(ret));
@@ -480,6 +493,77 @@ int ObGranuleUtil::get_tasks_for_partition(ObIAllocator &allocator,
   return ret;
 }
 
+int ObGranuleUtil::sort_tablets_by_size(ObIAllocator &allocator,
+                                        const ObTableScanSpec *tsc,
+                                        const ObIArray<ObNewRange> &input_ranges,
+                                        const ObIArray<ObDASTabletLoc*> &tablets,
+                                        ObIArray<ObDASTabletLoc*> &sorted_tablets)
+{
+  int ret = OB_SUCCESS;
+  ObAccessService *access_service = MTL(ObAccessService *);
+  ObSEArray<int64_t, 16> tablet_sizes;
+  ObSEArray<ObStoreRange, 16> input_store_ranges;
+  bool need_convert_new_range = true;
+  for (int64_t i = 0; OB_SUCC(ret) && i < tablets.count(); i++) {
+    const ObDASTabletLoc &tablet = *tablets.at(i);
+    int64_t partition_size = 0;
+    if (need_convert_new_range &&
+        OB_FAIL(convert_new_range_to_store_range(allocator,
+                                                 tsc,
+                                                 tablet.tablet_id_,
+                                                 input_ranges,
+                                                 input_store_ranges,
+                                                 need_convert_new_range))) {
+      LOG_WARN("failed to convert new range to store range", K(ret));
+    } else if (OB_FAIL(access_service->get_multi_ranges_cost(tablet.ls_id_,
+                                                             tablet.tablet_id_,
+                                                             input_store_ranges,
+                                                             partition_size))) {
+      LOG_WARN("failed to get multi ranges cost", K(ret), K(tablet));
+    } else if (OB_FAIL(tablet_sizes.push_back(partition_size))) {
+      LOG_WARN("failed to push back size", K(ret));
+    }
+  }
+  if (OB_SUCC(ret) && OB_FAIL(order_tablets_by_size(tablet_sizes, tablets, sorted_tablets))) {
+    LOG_WARN("failed to order tablets by size", K(ret));
+  }
+  return ret;
+}
+
+int ObGranuleUtil::order_tablets_by_size(const ObIArray<int64_t> &tablet_sizes,
+                                         const ObIArray<ObDASTabletLoc*> &tablets,
+                                         ObIArray<ObDASTabletLoc*> &sorted_tablets)
+{
+  int ret = OB_SUCCESS;
+  typedef std::pair<int64_t, int64_t> SizeIdxPair;
+  ObSEArray<SizeIdxPair, 16> size_idx_pairs;
+  sorted_tablets.reuse();
+  if (OB_UNLIKELY(tablet_sizes.count() != tablets.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("tablet sizes don't match tablets", K(ret), K(tablet_sizes.count()), K(tablets.count()));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < tablet_sizes.count(); i++) {
+    if (OB_FAIL(size_idx_pairs.push_back(SizeIdxPair(tablet_sizes.at(i), i)))) {
+      LOG_WARN("failed to push back size", K(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    // keep the original order for partitions of the same size
+    auto compare_fun = [](const SizeIdxPair &a, const SizeIdxPair &b) -> bool
+    {
+      return a.first > b.first || (a.first == b.first && a.second < b.second);
+    };
+    std::sort(size_idx_pairs.begin(), size_idx_pairs.end(), compare_fun);
+    for (int64_t i = 0; OB_SUCC(ret) && i < size_idx_pairs.count(); i++) {
+      if (OB_FAIL(sorted_tablets.push_back(tablets.at(size_idx_pairs.at(i).second)))) {
+        LOG_WARN("failed to push back tablet", K(ret));
+      }
+    }
+    LOG_TRACE("sort tablets by size", K(ret), K(sorted_tablets.count()));
+  }
+  return ret;
+}
+
 int ObGranuleUtil::convert_new_range_to_store_range(ObIAllocator &allocator,
                                                     const ObTableScanSpec *tsc,
                                                     const ObTabletID &tablet_id,
@@ -166,6 +166,7 @@ public:
    * granule_ranges             OUT the ranges info include ranges
    * granule_idx                OUT the idx used to divide the granule ranges
    * range_independent          IN  the random type witch affects the granule_idx
+   * large_partition_first      IN  order partition granules by data size descending
    *
    */
   static int split_block_ranges(common::ObIAllocator &allocator,
@@ -178,7 +179,8 @@ public:
                                 common::ObIArray<ObDASTabletLoc*> &granule_tablets,
                                 common::ObIArray<common::ObNewRange> &granule_ranges,
                                 common::ObIArray<int64_t> &granule_idx,
-                                bool range_independent);
+                                bool range_independent,
+                                bool large_partition_first = false);
 
   static bool is_partition_granule(int64_t partition_count,
                                    int64_t parallelism,
@@ -272,6 +274,31 @@ private:
                                      int64_t &pkey_idx,
                                      bool range_independent);
 
+  /**
+   * sort partitions by the estimated size of the query ranges, largest first
+   * allocator                   IN  memory allocator
+   * input_ranges                IN  query ranges extracted in optimizer stage
+   * tablets                     IN  the tablets to be sorted
+   *
+   * sorted_tablets              OUT the tablets in descending order of data size
+   */
+  static int sort_tablets_by_size(common::ObIAllocator &allocator,
+                                  const ObTableScanSpec *tsc,
+                                  const common::ObIArray<common::ObNewRange> &input_ranges,
+                                  const common::ObIArray<ObDASTabletLoc*> &tablets,
+                                  common::ObIArray<ObDASTabletLoc*> &sorted_tablets);
+
+  /**
+   * order partitions by data size descending, partitions of the same size keep their order
+   * tablet_sizes                IN  the data size of each tablet
+   * tablets                     IN  the tablets to be sorted
+   *
+   * sorted_tablets              OUT the tablets in descending order of data size
+   */
+  static int order_tablets_by_size(const common::ObIArray<int64_t> &tablet_sizes,
+                                   const common::ObIArray<ObDASTabletLoc*> &tablets,
+                                   common::ObIArray<ObDASTabletLoc*> &sorted_tablets);
+
   static int convert_new_range_to_store_range(common::ObIAllocator &allocator,
                                               const ObTableScanSpec *tsc,
                                               const common::ObTabletID &tablet_id,
@@ -37,7 +37,8 @@ using namespace obrpc;
 
 ObPxBloomFilter::ObPxBloomFilter() : data_length_(0), bits_count_(0), fpp_(0.0),
     hash_func_count_(0), is_inited_(false), bits_array_length_(0),
-    bits_array_(NULL), true_count_(0), begin_idx_(0), end_idx_(0), allocator_(), lock_(),
+    bits_array_(NULL), true_count_(0), begin_idx_(0), end_idx_(0), range_state_(RANGE_INIT),
+    range_min_(INT64_MAX), range_max_(INT64_MIN), allocator_(), lock_(),
     px_bf_recieve_count_(0), px_bf_recieve_size_(0), px_bf_merge_filter_count_(0)
 {
 
@@ -93,12 +94,19 @@ int ObPxBloomFilter::init(ObPxBloomFilter *filter)
     bits_array_ = filter->bits_array_;
     true_count_ = filter->true_count_;
     might_contain_ = filter->might_contain_;
+    range_state_ = filter->range_state_;
+    range_min_ = filter->range_min_;
+    range_max_ = filter->range_max_;
   }
   return ret;
 }
 void ObPxBloomFilter::reset_filter()
 {
   MEMSET(bits_array_, 0, bits_array_length_ * sizeof(int64_t));
+  // the key range is tracked again only if the creator enables it
+  range_state_ = RANGE_INIT;
+  range_min_ = INT64_MAX;
+  range_max_ = INT64_MIN;
   px_bf_recieve_count_ = 0;
   px_bf_recieve_size_ = 0;
 }
@@ -203,10 +211,34 @@ int ObPxBloomFilter::merge_filter(ObPxBloomFilter *filter)
         new_v = old_v | filter->bits_array_[i];
       } while(ATOMIC_CAS(&bits_array_[i + filter->begin_idx_], old_v, new_v) != old_v);
     }
+    merge_int_range(*filter);
   }
   return ret;
 }
 
+void ObPxBloomFilter::update_int_range(int64_t min_val, int64_t max_val)
+{
+  int64_t old_v = 0;
+  while (min_val < (old_v = ATOMIC_LOAD(&range_min_))
+         && !ATOMIC_BCAS(&range_min_, old_v, min_val)) {
+  }
+  while (max_val > (old_v = ATOMIC_LOAD(&range_max_))
+         && !ATOMIC_BCAS(&range_max_, old_v, max_val)) {
+  }
+}
+
+// the range can only be used if every piece merged into this filter carries it
+void ObPxBloomFilter::merge_int_range(const ObPxBloomFilter &filter)
+{
+  ObSpinLockGuard guard(lock_);
+  if (RANGE_TRACK != filter.range_state_) {
+    range_state_ = RANGE_DISABLED;
+  } else if (RANGE_DISABLED != range_state_) {
+    range_state_ = RANGE_TRACK;
+    update_int_range(filter.range_min_, filter.range_max_);
+  }
+}
+
 bool ObPxBloomFilter::check_ready()
 {
   return px_bf_recieve_count_ > 0 &&
@@ -320,6 +352,10 @@ OB_DEF_SERIALIZE(ObPxBloomFilter)
       LOG_WARN("fail to encode bits data", K(ret), K(bits_array_[i]));
     }
   }
+  LST_DO_CODE(OB_UNIS_ENCODE,
+              range_state_,
+              range_min_,
+              range_max_);
   return ret;
 }
 
@@ -358,6 +394,10 @@ OB_DEF_DESERIALIZE(ObPxBloomFilter)
                        : &ObPxBloomFilter::might_contain_nonsimd;
     }
   }
+  LST_DO_CODE(OB_UNIS_DECODE,
+              range_state_,
+              range_min_,
+              range_max_);
   return ret;
 }
 
@@ -377,6 +417,10 @@ OB_DEF_SERIALIZE_SIZE(ObPxBloomFilter)
   for (int i = begin_idx_; i <= end_idx_; ++i) {
     len += serialization::encoded_length(bits_array_[i]);
   }
+  LST_DO_CODE(OB_UNIS_ADD_LEN,
+        range_state_,
+        range_min_,
+        range_max_);
   return len;
 }
 
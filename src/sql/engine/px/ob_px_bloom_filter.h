@@ -89,8 +89,14 @@ public:
   typedef int (ObPxBloomFilter::*GetFunc)(uint64_t hash, bool &is_match);
   int generate_receive_count_array();
   void reset();
+  // value range of a single integer join key, probe values out of the range are
+  // rejected without touching the bits array.
+  void enable_int_range() { (void)ATOMIC_BCAS(&range_state_, RANGE_INIT, RANGE_TRACK); }
+  void update_int_range(int64_t min_val, int64_t max_val);
+  bool has_int_range() const { return RANGE_TRACK == range_state_; }
+  bool is_out_of_int_range(int64_t val) const { return val < range_min_ || val > range_max_; }
   TO_STRING_KV(K_(data_length), K_(bits_count), K_(fpp), K_(hash_func_count), K_(is_inited),
-      K_(bits_array_length), K_(true_count));
+      K_(bits_array_length), K_(true_count), K_(range_state), K_(range_min), K_(range_max));
 private:
   bool get(uint64_t pos, uint64_t index) { return (bits_array_[pos] & index) != 0; }
   bool set(uint64_t block_begin, uint64_t index);
@@ -98,6 +104,14 @@ private:
   void calc_num_of_bits();
   int might_contain_nonsimd(uint64_t hash, bool &is_match);
   int might_contain_simd(uint64_t hash, bool &is_match);
+  void merge_int_range(const ObPxBloomFilter &filter);
+
+  enum RangeState
+  {
+    RANGE_INIT = 0,   // no piece merged yet, or built by an old version
+    RANGE_TRACK = 1,  // every piece merged so far carries the range
+    RANGE_DISABLED = 2,
+  };
 
 private:
   int64_t data_length_;          //原始数据长度
@@ -111,6 +125,9 @@ private:
   int64_t begin_idx_;            // join filter begin position
   int64_t end_idx_;              // join filter end position
   GetFunc might_contain_;       // function pointer for might contain
+  int64_t range_state_;          // RangeState
+  int64_t range_min_;            // min value of the join key
+  int64_t range_max_;            // max value of the join key
 private:
   common::ObArenaAllocator allocator_;
   mutable common::ObSpinLock lock_;
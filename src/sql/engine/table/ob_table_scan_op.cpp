@@ -1507,7 +1507,10 @@ int ObTableScanOp::get_next_row_with_das()
   }
   while (OB_SUCC(ret) && !got_row) {
     clear_evaluated_flag();
-    if (OB_FAIL(scan_result_.get_next_row())) {
+    if (input_row_cnt_ > 0 && is_single_row_get()) {
+      ret = OB_ITER_END;
+      LOG_DEBUG("single row get iter end", K(ret), K_(input_row_cnt));
+    } else if (OB_FAIL(scan_result_.get_next_row())) {
       if (OB_ITER_END == ret) {
         if (OB_FAIL(scan_result_.next_result())) {
           if (OB_ITER_END != ret) {
@@ -1532,6 +1535,15 @@ int ObTableScanOp::get_next_row_with_das()
   return ret;
 }
 
+bool ObTableScanOp::is_single_row_get() const
+{
+  return MY_CTDEF.scan_ctdef_.is_get_
+      && !MY_SPEC.batch_scan_flag_
+      && !MY_SPEC.is_vt_mapping_
+      && 1 == MY_INPUT.key_ranges_.count()
+      && 1 == das_ref_.get_das_task_cnt();
+}
+
 int ObTableScanOp::get_next_batch_with_das(int64_t &count, int64_t capacity)
 {
   int ret = OB_SUCCESS;
@@ -1582,6 +1594,12 @@ int ObTableScanOp::get_next_batch_with_das(int64_t &count, int64_t capacity)
   bool got_batch = false;
   while (OB_SUCC(ret) && !got_batch) {
     clear_evaluated_flag();
+    if (input_row_cnt_ > 0 && is_single_row_get()) {
+      count = 0;
+      ret = OB_ITER_END;
+      LOG_DEBUG("single row get iter end", K(ret), K_(input_row_cnt));
+      break;
+    }
     // ObNewIterIterator::get_next_rows() may return rows too when got OB_ITER_END.
     // It's hard to use, we split it into two calls here since get_next_rows() is reentrant
     // when got OB_ITER_END.
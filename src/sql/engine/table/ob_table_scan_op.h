@@ -415,6 +415,9 @@ protected:
   int reshape_ddl_column_obj(common::ObDatum &datum, const ObObjMeta &obj_meta);
   int report_ddl_column_checksum();
   int get_next_batch_with_das(int64_t &count, int64_t capacity);
+  // a point get on the full rowkey of one tablet returns at most one row,
+  // so the iteration can end right after that row without asking storage again
+  bool is_single_row_get() const;
   void replace_bnlj_param(int64_t batch_idx);
   bool need_fetch_batch_result();
   static int check_is_physical_rowid(ObIAllocator &allocator,
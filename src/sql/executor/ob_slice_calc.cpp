@@ -752,7 +752,10 @@ int ObHashSliceIdCalc::get_slice_idx_vec(const ObIArray<ObExpr*> &, ObEvalCtx &e
                                          int64_t *&indexes)
 {
   int ret = OB_SUCCESS;
-  if (n_keys_ > hash_dist_exprs_->count()) {
+  if (OB_ISNULL(hash_dist_exprs_) || OB_ISNULL(hash_funcs_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("hash func and expr not init", K(ret));
+  } else if (n_keys_ > hash_dist_exprs_->count()) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("unexpected status: n_keys is invalid", K(ret),
       K(n_keys_), K(hash_dist_exprs_->count()));
@@ -782,12 +785,40 @@ int ObHashSliceIdCalc::get_slice_idx_vec(const ObIArray<ObExpr*> &, ObEvalCtx &e
           slice_indexes_[i] = hash_val[i] % task_cnt_;
         }
       }
+      if (ObNullDistributeMethod::NONE != null_row_dist_method_) {
+        distribute_null_rows_vec(eval_ctx, skip, batch_size);
+      }
       indexes = slice_indexes_;
     }
   }
   return ret;
 }
 
+void ObHashSliceIdCalc::distribute_null_rows_vec(ObEvalCtx &eval_ctx,
+                                                 const ObBitVector &skip,
+                                                 const int64_t batch_size)
+{
+  for (int64_t i = 0; i < batch_size; i++) {
+    if (skip.at(i)) {
+      continue;
+    }
+    bool found_null = false;
+    for (int64_t k = 0; !found_null && k < n_keys_; k++) {
+      const ObExpr *e = hash_dist_exprs_->at(k);
+      const ObDatum *datums = e->locate_batch_datums(eval_ctx);
+      found_null = e->is_batch_result() ? datums[i].is_null() : datums[0].is_null();
+    }
+    if (!found_null) {
+      // hash slice index already set
+    } else if (ObNullDistributeMethod::DROP == null_row_dist_method_) {
+      slice_indexes_[i] = ObSliceIdxCalc::DEFAULT_CHANNEL_IDX_TO_DROP_ROW;
+    } else if (ObNullDistributeMethod::RANDOM == null_row_dist_method_) {
+      slice_indexes_[i] = round_robin_idx_ % task_cnt_;
+      round_robin_idx_++;
+    }
+  }
+}
+
 /*******************                 ObSlaveMapPkeyRangeIdxCalc                 ********************/
 
 ObSlaveMapPkeyRangeIdxCalc::~ObSlaveMapPkeyRangeIdxCalc()
@@ -643,11 +643,7 @@ public:
         round_robin_idx_(0), obj_casted_(false), hash_dist_exprs_(NULL), hash_funcs_(NULL),
         n_keys_(0)
   {
-    if (ObNullDistributeMethod::NONE != null_row_dist_method) {
-      support_vectorized_calc_ = false;
-    } else {
-      support_vectorized_calc_ = true;
-    }
+    support_vectorized_calc_ = true;
   }
 
   ObHashSliceIdCalc(ObIAllocator &alloc,
@@ -660,11 +656,7 @@ public:
         obj_casted_(false), hash_dist_exprs_(dist_exprs), hash_funcs_(hash_funcs),
         n_keys_(dist_exprs->count())
   {
-    if (ObNullDistributeMethod::NONE != null_row_dist_method) {
-      support_vectorized_calc_ = false;
-    } else {
-      support_vectorized_calc_ = true;
-    }
+    support_vectorized_calc_ = true;
   }
 
   int calc_hash_value(ObEvalCtx &eval_ctx, uint64_t &hash_val);
@@ -677,6 +669,9 @@ public:
   virtual int get_slice_idx_vec(const ObIArray<ObExpr*> &exprs, ObEvalCtx &eval_ctx,
                         ObBitVector &skip, const int64_t batch_size,
                         int64_t *&indexes) override;
+  // drop or round robin the rows with null keys in batch, the same as calc_slice_idx()
+  void distribute_null_rows_vec(ObEvalCtx &eval_ctx, const ObBitVector &skip,
+                                const int64_t batch_size);
 
   common::ObExprCtx *expr_ctx_;
   const common::ObIArray<ObHashColumn> *hash_dist_columns_;
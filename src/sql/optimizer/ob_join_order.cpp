@@ -4660,7 +4660,7 @@ int JoinPath::can_use_batch_nlj(bool &use_batch_nlj)
     LOG_WARN("invalid argument", K(session_info), K(ret));
   } else if (NESTED_LOOP_JOIN == join_algo_
       && CONNECT_BY_JOIN != join_type_
-      && (!IS_SEMI_ANTI_JOIN(join_type_))
+      && !IS_RIGHT_SEMI_ANTI_JOIN(join_type_)
       && right_path_->is_inner_path()
       && !right_path_->nl_params_.empty()) {
     ObLogTableScan *ts = NULL;
@@ -13,6 +13,8 @@
 #define USING_LOG_PREFIX SQL_PC
 #include "sql/plan_cache/ob_i_lib_cache_node.h"
 #include "sql/plan_cache/ob_plan_cache.h"
+#include "lib/coro/co_var.h"
+#include "lib/random/ob_random.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::share::schema;
@@ -153,8 +155,18 @@ int ObILibCacheNode::lock(bool is_rdlock)
 int ObILibCacheNode::update_node_stat(ObILibCacheCtx &ctx)
 {
   int ret = OB_SUCCESS;
-  ATOMIC_STORE(&(node_stat_.last_active_timestamp_), ObTimeUtility::current_time());
-  ATOMIC_INC(&(node_stat_.execute_count_));
+  const int64_t cur_ts = ObTimeUtility::fast_current_time();
+  // only refresh active timestamp when it is stale enough, so that hits of hot
+  // node do not keep writing the same cache line
+  if (cur_ts - ATOMIC_LOAD(&(node_stat_.last_active_timestamp_)) >= ACTIVE_TS_REFRESH_INTERVAL_US) {
+    ATOMIC_STORE(&(node_stat_.last_active_timestamp_), cur_ts);
+  }
+  // execute count is a statistic only, each hit is sampled with probability
+  // 1/EXECUTE_COUNT_SAMPLE_RATE by the thread local random seed and charged that many
+  // hits, so the expectation of every node is its real hit count
+  if (0 == ObRandom::rand(0, EXECUTE_COUNT_SAMPLE_RATE - 1)) {
+    (void)ATOMIC_AAF(&(node_stat_.execute_count_), EXECUTE_COUNT_SAMPLE_RATE);
+  }
   return ret;
 }
 
@@ -209,14 +221,10 @@ int64_t ObILibCacheNode::dec_ref_count(const CacheRefHandleID ref_handle)
     if (OB_ISNULL(lib_cache_)) {
       LOG_ERROR("invalid null lib cache");
     } else {
-      ObLCNodeFactory &ln_factory = lib_cache_->get_cache_node_factory();
-      if (OB_FAIL(before_cache_evicted())) {
-        LOG_WARN("failed to process before_cache_evicted", K(ret));
-      }
-      // regardless of whether before_cache_evicted succeeds or fails, the cache node
-      // will be evicted. so ignore the error code here
-      lib_cache_->dec_mem_used(get_mem_size());
-      ln_factory.destroy_cache_node(this);
+      // the node has been removed from lib cache, but readers in the critical section
+      // of node qsync may still access it without reference count, so it is freed by
+      // the background evict task after these readers quiesce
+      lib_cache_->retire_cache_node(this);
     }
   } else {
     LOG_ERROR("invalid pcv_set ref count", K(ref_count));
@@ -224,6 +232,19 @@ int64_t ObILibCacheNode::dec_ref_count(const CacheRefHandleID ref_handle)
   return ref_count;
 }
 
+void ObILibCacheNode::free_retired()
+{
+  int ret = OB_SUCCESS;
+  ObLCNodeFactory &ln_factory = lib_cache_->get_cache_node_factory();
+  if (OB_FAIL(before_cache_evicted())) {
+    LOG_WARN("failed to process before_cache_evicted", K(ret));
+  }
+  // regardless of whether before_cache_evicted succeeds or fails, the cache node
+  // will be evicted. so ignore the error code here
+  lib_cache_->dec_mem_used(get_mem_size());
+  ln_factory.destroy_cache_node(this);
+}
+
 int ObILibCacheNode::before_cache_evicted()
 {
   int ret = OB_SUCCESS;
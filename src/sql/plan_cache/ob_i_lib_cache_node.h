@@ -97,12 +97,15 @@ class ObILibCacheNode
 {
 friend class ObLCNodeFactory;
 public:
+  static const int64_t ACTIVE_TS_REFRESH_INTERVAL_US = 10 * 1000; // 10ms
+  static const int64_t EXECUTE_COUNT_SAMPLE_RATE = 16;
   ObILibCacheNode(ObPlanCache *lib_cache, lib::MemoryContext &mem_context)
     : mem_context_(mem_context),
       allocator_(mem_context->get_safe_arena_allocator()),
       rwlock_(),
       ref_count_(0),
       lib_cache_(lib_cache),
+      retire_next_(NULL),
       co_list_lock_(common::ObLatchIds::PLAN_SET_LOCK),
       co_list_(allocator_)
   {
@@ -160,6 +163,10 @@ public:
   lib::MemoryContext &get_mem_context() { return mem_context_; }
   int64_t get_mem_size();
   ObPlanCache *get_lib_cache() const { return lib_cache_; }
+  ObILibCacheNode *get_retire_next() const { return retire_next_; }
+  void set_retire_next(ObILibCacheNode *next) { retire_next_ = next; }
+  // destroy the node after it is retired and no reader can access it
+  void free_retired();
 
   VIRTUAL_TO_STRING_KV(K_(ref_count), K_(lock_timeout_ts));
 
@@ -209,6 +216,8 @@ protected:
   int64_t lock_timeout_ts_;
   StmtStat node_stat_;
   ObPlanCache *lib_cache_;
+  // link in the retired node list of lib cache
+  ObILibCacheNode *retire_next_;
   common::SpinRWLock co_list_lock_;
   CacheObjList co_list_;
 };
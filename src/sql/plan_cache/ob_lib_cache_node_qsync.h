@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_PLAN_CACHE_OB_LIB_CACHE_NODE_QSYNC_
+#define OCEANBASE_SQL_PLAN_CACHE_OB_LIB_CACHE_NODE_QSYNC_
+
+#include "lib/ob_define.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/thread_local/ob_tsi_utils.h"
+#include "lib/oblog/ob_log.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+// ObLCNodeQSync is a quiescent state sync like common::ObQSync, but sync() is guaranteed
+// to return under steady read load.
+//
+// ObQSync keeps one reader count per slot, a slot which is entered again right after it is
+// left may never be seen as zero, so the waiter could spin forever on a busy plan cache.
+// Here the reader counts have two generations, readers always enter the current one:
+// 1. sync() switches the current generation and waits for the readers of the old one, the
+//    readers entering after the switch don't delay it, so the wait is bounded by the
+//    longest critical section;
+// 2. a reader that loaded the old generation but increased its count after the switch
+//    leaves it and enters the current one, it hasn't accessed anything yet.
+// Only one sync() may run at the same time.
+class ObLCNodeQSync
+{
+public:
+  static const int64_t MAX_REF_CNT = 256;
+  ObLCNodeQSync() : gen_(0) {}
+  ~ObLCNodeQSync() {}
+  // @return the token passed to release_ref()
+  int64_t acquire_ref()
+  {
+    const int64_t slot = common::get_itid() % MAX_REF_CNT;
+    int64_t gen = ATOMIC_LOAD(&gen_);
+    ATOMIC_AAF(&ref_array_[gen][slot].ref_, 1);
+    while (OB_UNLIKELY(gen != ATOMIC_LOAD(&gen_))) {
+      ATOMIC_AAF(&ref_array_[gen][slot].ref_, -1);
+      gen = ATOMIC_LOAD(&gen_);
+      ATOMIC_AAF(&ref_array_[gen][slot].ref_, 1);
+    }
+    return gen * MAX_REF_CNT + slot;
+  }
+  void release_ref(const int64_t token)
+  {
+    const int64_t new_ref = ATOMIC_AAF(&ref_array_[token / MAX_REF_CNT][token % MAX_REF_CNT].ref_, -1);
+    if (OB_UNLIKELY(0 > new_ref)) {
+      COMMON_LOG(ERROR, "unexpected ref", K(new_ref), K(token));
+    }
+  }
+  // wait for the readers which entered before this call
+  void sync()
+  {
+    const int64_t old_gen = ATOMIC_LOAD(&gen_);
+    ATOMIC_STORE(&gen_, 1 - old_gen);
+    for (int64_t i = 0; i < MAX_REF_CNT; i++) {
+      while (0 != ATOMIC_LOAD(&ref_array_[old_gen][i].ref_)) {
+        PAUSE();
+      }
+    }
+  }
+private:
+  struct Ref
+  {
+    Ref() : ref_(0) {}
+    int64_t ref_ CACHE_ALIGNED;
+  };
+  int64_t gen_ CACHE_ALIGNED;
+  Ref ref_array_[2][MAX_REF_CNT];
+  DISALLOW_COPY_AND_ASSIGN(ObLCNodeQSync);
+};
+
+struct ObLCNodeCriticalGuard
+{
+  explicit ObLCNodeCriticalGuard(ObLCNodeQSync &qsync)
+    : qsync_(qsync), token_(qsync.acquire_ref()) {}
+  ~ObLCNodeCriticalGuard() { qsync_.release_ref(token_); }
+  ObLCNodeQSync &qsync_;
+  int64_t token_;
+};
+} // namespace sql
+} // namespace oceanbase
+
+#endif // OCEANBASE_SQL_PLAN_CACHE_OB_LIB_CACHE_NODE_QSYNC_
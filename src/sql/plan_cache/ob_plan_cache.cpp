@@ -333,7 +333,9 @@ ObPlanCache::ObPlanCache()
    ref_count_(0),
    ref_handle_mgr_(),
    pcm_(NULL),
-   destroy_(0)
+   destroy_(0),
+   retired_nodes_(NULL),
+   reclaim_lock_()
 {
 }
 
@@ -349,6 +351,7 @@ void ObPlanCache::destroy()
     if (OB_SUCCESS != (cache_evict_all_obj())) {
       SQL_PC_LOG(WARN, "fail to evict all lib cache cache");
     }
+    reclaim_retired_nodes();
     inited_ = false;
   }
 }
@@ -914,12 +917,14 @@ int ObPlanCache::get_cache_obj(ObILibCacheCtx &ctx,
   int ret = OB_SUCCESS;
   ObILibCacheNode *cache_node = NULL;
   ObILibCacheObject *cache_obj = NULL;
-  // get the read lock and increase reference count
-  ObLibCacheRlockAndRef r_ref_lock(LC_NODE_RD_HANDLE);
+  // get the read lock, the cache node is kept alive by node qsync
+  // instead of reference count, to avoid contention on hot nodes
+  ObLCNodeCriticalGuard node_guard(node_qsync_);
+  ObLibCacheRlock r_lock(LC_NODE_RD_HANDLE);
   if (OB_ISNULL(key)) {
     ret = OB_INVALID_ARGUMENT;
     SQL_PC_LOG(WARN, "invalid null argument", K(ret), K(key));
-  } else if (OB_FAIL(get_value(key, cache_node, r_ref_lock /*read locked*/))) {
+  } else if (OB_FAIL(get_value(key, cache_node, r_lock /*read locked*/))) {
     ret = OB_ERR_UNEXPECTED;
     SQL_PC_LOG(DEBUG, "failed to get cache node from lib cache by key", K(ret));
   } else if (OB_UNLIKELY(NULL == cache_node)) {
@@ -939,7 +944,6 @@ int ObPlanCache::get_cache_obj(ObILibCacheCtx &ctx,
     }
     // release lock whatever
     (void)cache_node->unlock();
-    (void)cache_node->dec_ref_count(LC_NODE_RD_HANDLE);
     NG_TRACE(pc_choose_plan);
   }
 
@@ -951,13 +955,14 @@ int ObPlanCache::cache_node_exists(ObILibCacheKey* key,
 {
   int ret = OB_SUCCESS;
   ObILibCacheNode *cache_node = NULL;
-  // get the read lock and increase reference count
-  ObLibCacheRlockAndRef r_ref_lock(LC_NODE_RD_HANDLE);
+  // get the read lock, the cache node is kept alive by node qsync
+  ObLCNodeCriticalGuard node_guard(node_qsync_);
+  ObLibCacheRlock r_lock(LC_NODE_RD_HANDLE);
   is_exists = false;
   if (OB_ISNULL(key)) {
     ret = OB_INVALID_ARGUMENT;
     SQL_PC_LOG(WARN, "invalid null argument", K(ret), K(key));
-  } else if (OB_FAIL(get_value(key, cache_node, r_ref_lock /*read locked*/))) {
+  } else if (OB_FAIL(get_value(key, cache_node, r_lock /*read locked*/))) {
     ret = OB_ERR_UNEXPECTED;
     SQL_PC_LOG(DEBUG, "failed to get cache node from lib cache by key", K(ret));
   } else if (OB_UNLIKELY(NULL == cache_node)) {
@@ -965,7 +970,6 @@ int ObPlanCache::cache_node_exists(ObILibCacheKey* key,
   } else {
     // release lock whatever
     (void)cache_node->unlock();
-    (void)cache_node->dec_ref_count(LC_NODE_RD_HANDLE);
     is_exists = true;
   }
 
@@ -1124,6 +1128,7 @@ int ObPlanCache::cache_evict()
   int ret = OB_SUCCESS;
   int64_t cache_evict_num = 0;
   ObGlobalReqTimeService::check_req_timeinfo();
+  reclaim_retired_nodes();
   SQL_PC_LOG(INFO, "start lib cache evict",
              K_(tenant_id),
              "mem_hold", get_mem_hold(),
@@ -1150,6 +1155,36 @@ int ObPlanCache::cache_evict()
   return ret;
 }
 
+void ObPlanCache::retire_cache_node(ObILibCacheNode *node)
+{
+  ObILibCacheNode *head = NULL;
+  do {
+    head = ATOMIC_LOAD(&retired_nodes_);
+    node->set_retire_next(head);
+  } while (!ATOMIC_BCAS(&retired_nodes_, head, node));
+}
+
+void ObPlanCache::reclaim_retired_nodes()
+{
+  ObSpinLockGuard guard(reclaim_lock_);
+  // nodes retired before this point have been removed from cache_key_node_map_,
+  // readers that may still access them entered node_qsync_ before sync()
+  ObILibCacheNode *node = ATOMIC_TAS(&retired_nodes_, NULL);
+  if (NULL != node) {
+    int64_t free_cnt = 0;
+    const int64_t start_ts = ObTimeUtility::current_time();
+    node_qsync_.sync();
+    while (NULL != node) {
+      ObILibCacheNode *next = node->get_retire_next();
+      node->free_retired();
+      node = next;
+      ++free_cnt;
+    }
+    SQL_PC_LOG(DEBUG, "free retired lib cache nodes", K_(tenant_id), K(free_cnt),
+               "wait_time", ObTimeUtility::current_time() - start_ts);
+  }
+}
+
 int ObPlanCache::asyn_update_baseline()
 {
   int ret = OB_SUCCESS;
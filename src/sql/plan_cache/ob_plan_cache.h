@@ -16,6 +16,7 @@
 #include "lib/net/ob_addr.h"
 #include "lib/hash/ob_hashmap.h"
 #include "lib/alloc/alloc_func.h"
+#include "lib/lock/ob_spin_lock.h"
 #include "sql/plan_cache/ob_plan_cache_util.h"
 #include "sql/plan_cache/ob_id_manager_allocator.h"
 #include "sql/plan_cache/ob_sql_parameterization.h"
@@ -24,6 +25,7 @@
 #include "sql/plan_cache/ob_lib_cache_key_creator.h"
 #include "sql/plan_cache/ob_lib_cache_node_factory.h"
 #include "sql/plan_cache/ob_lib_cache_object_manager.h"
+#include "sql/plan_cache/ob_lib_cache_node_qsync.h"
 
 namespace oceanbase
 {
@@ -296,6 +298,15 @@ public:
   int remove_cache_obj_stat_entry(const ObCacheObjID cache_obj_id);
   ObLCObjectManager &get_cache_obj_mgr() { return co_mgr_; }
   ObLCNodeFactory &get_cache_node_factory() { return cn_factory_; }
+  // readers in a critical section of node_qsync_ access cache nodes without
+  // holding a node reference, a node is destroyed only after they quiesce
+  ObLCNodeQSync &get_node_qsync() { return node_qsync_; }
+  // called by the last dec_ref_count() of a node removed from the cache, the node
+  // is freed later by reclaim_retired_nodes()
+  void retire_cache_node(ObILibCacheNode *node);
+  // wait for the readers of node_qsync_ which may access the retired nodes and free them,
+  // the readers entering during the wait don't delay it
+  void reclaim_retired_nodes();
   int alloc_cache_obj(ObCacheObjGuard& guard, ObLibCacheNameSpace ns, uint64_t tenant_id);
   void free_cache_obj(ObILibCacheObject *&cache_obj, const CacheRefHandleID ref_handle);
   int destroy_cache_obj(const bool is_leaked, const uint64_t object_id);
@@ -387,6 +398,10 @@ private:
   ObLCObjectManager co_mgr_;
   ObLCNodeFactory cn_factory_;
   CacheKeyNodeMap cache_key_node_map_;
+  ObLCNodeQSync node_qsync_;
+  // nodes pushed by retire_cache_node()
+  ObILibCacheNode *retired_nodes_;
+  common::ObSpinLock reclaim_lock_;
 };
 
 template<typename _callback>
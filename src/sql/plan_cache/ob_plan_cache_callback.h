@@ -26,8 +26,8 @@ protected:
   typedef common::hash::HashMapPair<ObILibCacheKey*, ObILibCacheNode *> LibCacheKV;
 
 public:
-  ObLibCacheAtomicOp(const CacheRefHandleID ref_handle)
-    : cache_node_(NULL), ref_handle_(ref_handle)
+  ObLibCacheAtomicOp(const CacheRefHandleID ref_handle, const bool need_ref = true)
+    : cache_node_(NULL), ref_handle_(ref_handle), need_ref_(need_ref)
   {
   }
   virtual ~ObLibCacheAtomicOp() {}
@@ -45,6 +45,8 @@ protected:
   // cache_node_ - the plan cache value that is referenced.
   ObILibCacheNode *cache_node_;
   CacheRefHandleID ref_handle_;
+  // false if the caller keeps the node alive by the node qsync of the lib cache
+  bool need_ref_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObLibCacheAtomicOp);
 };
@@ -81,6 +83,24 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObLibCacheRlockAndRef);
 };
 
+// get read lock without increasing the reference count of cache node,
+// must be used in the critical section of ObPlanCache::get_node_qsync()
+class ObLibCacheRlock : public ObLibCacheAtomicOp
+{
+public:
+  ObLibCacheRlock(const CacheRefHandleID ref_handle)
+    : ObLibCacheAtomicOp(ref_handle, false /*need_ref*/)
+  {
+  }
+  virtual ~ObLibCacheRlock() {}
+  int lock(ObILibCacheNode &cache_node)
+  {
+    return cache_node.lock(true/*rlock*/);
+  };
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObLibCacheRlock);
+};
+
 class ObCacheObjAtomicOp
 {
 protected:
@@ -538,7 +538,7 @@ int ObIndexTreeMultiPassPrefetcher::init_basic_info(
     case ObStoreRowIterator::IteratorMultiGet: {
       rowkeys_ = static_cast<const common::ObIArray<blocksstable::ObDatumRowkey> *> (query_range);
       range_count = rowkeys_->count();
-      max_range_prefetching_cnt_ = min(range_count, DEFAULT_SCAN_RANGE_PREFETCH_CNT);
+      max_range_prefetching_cnt_ = min(range_count, DEFAULT_GET_RANGE_PREFETCH_CNT);
       if (0 == range_count) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("range count should be greater than 0", K(ret), K(range_count));
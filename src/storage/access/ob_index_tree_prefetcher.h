@@ -294,6 +294,9 @@ private:
   }
 
   static const int32_t DEFAULT_SCAN_RANGE_PREFETCH_CNT = 4;
+  // each rowkey of multi get reads at most one micro data block, keep more rowkeys in flight
+  // so that the random reads of index lookup overlap, up to half of the micro data handles
+  static const int32_t DEFAULT_GET_RANGE_PREFETCH_CNT = 16;
   static const int32_t DEFAULT_SCAN_MICRO_DATA_HANDLE_CNT = 32;
   static const int32_t INDEX_TREE_PREFETCH_DEPTH = 3;
   struct ObIndexBlockReadHandle {
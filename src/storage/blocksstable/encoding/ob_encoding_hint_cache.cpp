@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_encoding_hint_cache.h"
+#include "lib/allocator/ob_malloc.h"
+#include "share/rc/ob_tenant_base.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+
+void ObEncodingHintCache::Slot::free_encodings()
+{
+  if (nullptr != encodings_) {
+    ob_free(encodings_);
+    encodings_ = nullptr;
+  }
+  tablet_id_.reset();
+  schema_version_ = 0;
+  column_cnt_ = 0;
+}
+
+int ObEncodingHintCache::mtl_init(ObEncodingHintCache *&cache)
+{
+  return cache->init(MTL_ID());
+}
+
+int ObEncodingHintCache::init(const uint64_t tenant_id)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret), K_(tenant_id));
+  } else if (OB_UNLIKELY(!is_valid_tenant_id(tenant_id))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(tenant_id));
+  } else {
+    tenant_id_ = tenant_id;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObEncodingHintCache::get(
+    const ObTabletID &tablet_id,
+    const int64_t schema_version,
+    const int64_t column_cnt,
+    EncodingArrays &encodings)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(!tablet_id.is_valid() || column_cnt <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(tablet_id), K(column_cnt));
+  } else {
+    Slot &slot = get_slot(tablet_id);
+    ObSpinLockGuard guard(slot.lock_);
+    if (!slot.match(tablet_id, schema_version) || column_cnt != slot.column_cnt_) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      encodings.reuse();
+      for (int64_t i = 0; OB_SUCC(ret) && i < slot.column_cnt_; ++i) {
+        if (OB_FAIL(encodings.push_back(slot.encodings_[i]))) {
+          LOG_WARN("failed to push back encoding hint", K(ret), K(i));
+        }
+      }
+      if (OB_FAIL(ret)) {
+        encodings.reuse();
+      }
+    }
+  }
+  return ret;
+}
+
+int ObEncodingHintCache::put(
+    const ObTabletID &tablet_id,
+    const int64_t schema_version,
+    const EncodingArrays &encodings)
+{
+  int ret = OB_SUCCESS;
+  const int64_t column_cnt = encodings.count();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(!tablet_id.is_valid() || column_cnt <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(tablet_id), K(column_cnt));
+  } else {
+    Slot &slot = get_slot(tablet_id);
+    ObSpinLockGuard guard(slot.lock_);
+    if (nullptr != slot.encodings_ && column_cnt != slot.column_cnt_) {
+      slot.free_encodings();
+    }
+    if (nullptr == slot.encodings_) {
+      const ObMemAttr attr(tenant_id_, "EncodingHint");
+      if (OB_ISNULL(slot.encodings_ = static_cast<EncodingArray *>(
+          ob_malloc(sizeof(EncodingArray) * column_cnt, attr)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc encoding hint", K(ret), K(column_cnt));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      for (int64_t i = 0; i < column_cnt; ++i) {
+        slot.encodings_[i] = encodings.at(i);
+      }
+      slot.tablet_id_ = tablet_id;
+      slot.schema_version_ = schema_version;
+      slot.column_cnt_ = column_cnt;
+    }
+  }
+  return ret;
+}
+
+void ObEncodingHintCache::destroy()
+{
+  for (int64_t i = 0; i < SLOT_COUNT; ++i) {
+    ObSpinLockGuard guard(slots_[i].lock_);
+    slots_[i].free_encodings();
+  }
+  tenant_id_ = OB_INVALID_TENANT_ID;
+  is_inited_ = false;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_BLOCKSSTABLE_OB_ENCODING_HINT_CACHE_H_
+#define OCEANBASE_BLOCKSSTABLE_OB_ENCODING_HINT_CACHE_H_
+
+#include "common/ob_tablet_id.h"
+#include "lib/lock/ob_spin_lock.h"
+#include "storage/blocksstable/ob_block_sstable_struct.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// Remember the column encodings chosen by the last major compaction of a tablet,
+// so that the next compaction can seed its encoder with them instead of
+// re-detecting every column from scratch. The periodic full detection in
+// ObMicroBlockEncoder still runs, so a stale hint only costs one extra try.
+//
+// One instance per tenant (MTL), the hints are charged to the tenant and freed
+// with it. Direct mapped and in memory only, a conflicting tablet simply evicts
+// the slot.
+class ObEncodingHintCache
+{
+public:
+  typedef ObPreviousEncodingArray<ObMicroBlockEncodingCtx::MAX_PREV_ENCODING_COUNT> EncodingArray;
+  typedef common::ObIArray<EncodingArray> EncodingArrays;
+
+  ObEncodingHintCache() : is_inited_(false), tenant_id_(common::OB_INVALID_TENANT_ID) {}
+  ~ObEncodingHintCache() { destroy(); }
+  static int mtl_init(ObEncodingHintCache *&cache);
+  int init(const uint64_t tenant_id);
+  void destroy();
+
+  // return OB_ENTRY_NOT_EXIST if no hint matches the tablet, schema version and column count
+  int get(const common::ObTabletID &tablet_id,
+          const int64_t schema_version,
+          const int64_t column_cnt,
+          EncodingArrays &encodings);
+  int put(const common::ObTabletID &tablet_id,
+          const int64_t schema_version,
+          const EncodingArrays &encodings);
+
+private:
+  static const int64_t SLOT_COUNT = 1024;
+  struct Slot
+  {
+    Slot() : lock_(), tablet_id_(), schema_version_(0),
+             column_cnt_(0), encodings_(nullptr) {}
+    bool match(const common::ObTabletID &tablet_id, const int64_t schema_version) const
+    {
+      return nullptr != encodings_ && tablet_id_ == tablet_id && schema_version_ == schema_version;
+    }
+    void free_encodings();
+
+    common::ObSpinLock lock_;
+    common::ObTabletID tablet_id_;
+    int64_t schema_version_;
+    int64_t column_cnt_;
+    EncodingArray *encodings_;
+  };
+
+  OB_INLINE Slot &get_slot(const common::ObTabletID &tablet_id)
+  {
+    return slots_[tablet_id.hash() % SLOT_COUNT];
+  }
+
+private:
+  bool is_inited_;
+  uint64_t tenant_id_;
+  Slot slots_[SLOT_COUNT];
+  DISALLOW_COPY_AND_ASSIGN(ObEncodingHintCache);
+};
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+#endif // OCEANBASE_BLOCKSSTABLE_OB_ENCODING_HINT_CACHE_H_
@@ -99,7 +99,7 @@ ObMicroBlockEncoder::ObMicroBlockEncoder() : ctx_(), header_(NULL),
     row_buf_holder_(blocksstable::OB_ENCODING_LABEL_ROW_BUFFER, OB_MALLOC_MIDDLE_BLOCK_SIZE),
     encoder_allocator_(encoder_sizes, common::ObModIds::OB_ENCODER_ALLOCATOR),
     string_col_cnt_(0), estimate_base_store_size_(0), length_(0),
-    is_inited_(false)
+    hint_micro_block_cnt_(0), detect_column_cnt_(0), is_inited_(false)
 {
 }
 
@@ -155,6 +155,25 @@ int ObMicroBlockEncoder::init(const ObMicroBlockEncodingCtx &ctx)
   return ret;
 }
 
+int ObMicroBlockEncoder::set_previous_encodings(
+    const ObIArray<ObPreviousEncodingArray<ObMicroBlockEncodingCtx::MAX_PREV_ENCODING_COUNT> > &encodings)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(encodings.count() != ctx_.column_cnt_ || 0 != ctx_.micro_block_cnt_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid previous encodings", K(ret), "count", encodings.count(), K_(ctx));
+  } else if (OB_FAIL(ctx_.previous_encodings_.assign(encodings))) {
+    LOG_WARN("failed to assign previous encodings", K(ret));
+    ctx_.previous_encodings_.reuse();
+  } else {
+    hint_micro_block_cnt_ = ENCODING_HINT_MICRO_BLOCK_CNT;
+  }
+  return ret;
+}
+
 int ObMicroBlockEncoder::inner_init()
 {
   int ret = OB_SUCCESS;
@@ -206,6 +225,8 @@ void ObMicroBlockEncoder::reset()
   col_ctxs_.reset();
   string_col_cnt_ = 0;
   length_ = 0;
+  hint_micro_block_cnt_ = 0;
+  detect_column_cnt_ = 0;
 }
 
 void ObMicroBlockEncoder::reuse()
@@ -320,7 +341,8 @@ void ObMicroBlockEncoder::print_micro_block_encoder_status() const
 {
   FLOG_INFO("Build micro block failed, print encoder status: ", K_(ctx),
       K_(header), K_(estimate_size), K_(estimate_size_limit), K_(header_size),
-      K_(expand_pct), K_(string_col_cnt), K_(estimate_base_store_size), K_(length));
+      K_(expand_pct), K_(string_col_cnt), K_(estimate_base_store_size), K_(length),
+      K_(hint_micro_block_cnt), K_(detect_column_cnt));
   int64_t idx = 0;
   FOREACH(e, encoders_) {
     FLOG_INFO("Print column encoder: ", K(idx), KPC(*e));
@@ -1320,14 +1342,17 @@ int ObMicroBlockEncoder::try_previous_encoder(ObIColumnEncoder *&choose,
   } else {
     bool need_calc = false;
     int64_t cycle_cnt = 0;
-    if (32 < ctx_.micro_block_cnt_) {
+    // the micro blocks hinted encodings learned from count too, otherwise the first micro
+    // block always re-detects and the hint never saves anything
+    const int64_t micro_block_cnt = ctx_.micro_block_cnt_ + hint_micro_block_cnt_;
+    if (32 < micro_block_cnt) {
       cycle_cnt = 16;
-    } else if (16 < ctx_.micro_block_cnt_) {
+    } else if (16 < micro_block_cnt) {
       cycle_cnt = 8;
     } else {
       cycle_cnt = 4;
     }
-    need_calc = (0 == ctx_.micro_block_cnt_ % cycle_cnt);
+    need_calc = (0 == micro_block_cnt % cycle_cnt);
 
     if (column_index < ctx_.previous_encodings_.count()) {
       int64_t pos = ctx_.previous_encodings_.at(column_index).last_pos_;
@@ -1501,6 +1526,8 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
     if (OB_SUCC(ret) && try_more) {
       if (OB_FAIL(try_previous_encoder(choose, column_idx, acceptable_size, try_more))) {
         LOG_WARN("try previous encoder failed", K(ret), K(column_idx));
+      } else if (try_more) {
+        ++detect_column_cnt_;
       }
     }
 
@@ -36,6 +36,9 @@ class ObMicroBlockEncoder : public ObIMicroBlockWriter
 public:
   static const int64_t MAX_ENCODING_META_LENGTH = UINT16_MAX;
   static const int64_t DEFAULT_ESTIMATE_REAL_SIZE_PCT = 150;
+  // hinted encodings are learned from a whole major sstable, re-detect as seldom as an
+  // encoder which has built more than 32 micro blocks
+  static const int64_t ENCODING_HINT_MICRO_BLOCK_CNT = 33;
 
   // maximum row count is restricted to 4 bytes in MicroBlockHeader
   static const int64_t MAX_MICRO_BLOCK_ROW_CNT = UINT32_MAX;
@@ -81,6 +84,14 @@ public:
   virtual int64_t get_column_count() const { return ctx_.column_cnt_;}
   virtual int64_t get_original_size() const { return estimate_size_; }
   virtual void dump_diagnose_info() const override;
+  // encodings chosen by previous micro blocks, used as hints across compactions.
+  // The hinted encodings are tried first from the first micro block on, full detection
+  // only runs when they are not suitable or not good enough, and periodically as if they
+  // were learned by this encoder from ENCODING_HINT_MICRO_BLOCK_CNT micro blocks.
+  const common::ObIArray<ObPreviousEncodingArray<ObMicroBlockEncodingCtx::MAX_PREV_ENCODING_COUNT> > &
+      get_previous_encodings() const { return ctx_.previous_encodings_; }
+  int set_previous_encodings(
+      const common::ObIArray<ObPreviousEncodingArray<ObMicroBlockEncodingCtx::MAX_PREV_ENCODING_COUNT> > &encodings);
 private:
   int inner_init();
   int reserve_header(const ObMicroBlockEncodingCtx &ctx);
@@ -177,6 +188,10 @@ private:
   int64_t estimate_base_store_size_;
   common::ObArray<ObColumnEncodingCtx> col_ctxs_;
   int64_t length_;
+  // non-zero if previous encodings are hinted by the previous major compaction
+  int64_t hint_micro_block_cnt_;
+  // columns not settled by previous encodings, fully detected
+  int64_t detect_column_cnt_;
   bool is_inited_;
 
   DISALLOW_COPY_AND_ASSIGN(ObMicroBlockEncoder);
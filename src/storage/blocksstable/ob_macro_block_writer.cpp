@@ -19,6 +19,7 @@
 #include "share/ob_force_print_log.h"
 #include "share/ob_task_define.h"
 #include "share/schema/ob_table_schema.h"
+#include "storage/blocksstable/encoding/ob_encoding_hint_cache.h"
 #include "storage/blocksstable/ob_index_block_builder.h"
 #include "storage/blocksstable/ob_index_block_macro_iterator.h"
 #include "storage/blocksstable/ob_index_block_row_struct.h"
@@ -351,6 +352,7 @@ int ObMacroBlockWriter::open(
                                      micro_writer_,
                                      GCONF.micro_block_merge_verify_level))) {
         STORAGE_LOG(WARN, "fail to build micro writer", K(ret));
+      } else if (FALSE_IT(load_encoding_hint())) {
       } else if (OB_FAIL(read_info_.init(
                          allocator_,
                          data_store_desc.row_column_count_ - ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt(),
@@ -615,11 +617,53 @@ int ObMacroBlockWriter::close()
         STORAGE_LOG(WARN, "fail to close data index builder", K(ret), K(last_key_));
       }
     }
+    if (OB_SUCC(ret)) {
+      save_encoding_hint();
+    }
   }
   return ret;
 }
 
 
+void ObMacroBlockWriter::load_encoding_hint()
+{
+  int ret = OB_SUCCESS;
+  if (data_store_desc_->is_major_merge() && data_store_desc_->encoding_enabled()) {
+    ObArray<ObEncodingHintCache::EncodingArray> encodings;
+    ObEncodingHintCache *hint_cache = MTL(ObEncodingHintCache *);
+    if (OB_ISNULL(hint_cache)) {
+      // not a tenant thread, no hint
+    } else if (OB_FAIL(hint_cache->get(data_store_desc_->tablet_id_,
+                                       data_store_desc_->schema_version_,
+                                       data_store_desc_->row_column_count_,
+                                       encodings))) {
+      if (OB_ENTRY_NOT_EXIST != ret) {
+        STORAGE_LOG(WARN, "fail to get encoding hint", K(ret), KPC_(data_store_desc));
+      }
+    } else if (OB_FAIL(static_cast<ObMicroBlockEncoder *>(micro_writer_)->set_previous_encodings(encodings))) {
+      STORAGE_LOG(WARN, "fail to set previous encodings", K(ret), KPC_(data_store_desc));
+    }
+  }
+}
+
+void ObMacroBlockWriter::save_encoding_hint()
+{
+  int ret = OB_SUCCESS;
+  if (data_store_desc_->is_major_merge() && data_store_desc_->encoding_enabled()) {
+    const ObMicroBlockEncoder *encoder = static_cast<ObMicroBlockEncoder *>(micro_writer_);
+    ObEncodingHintCache *hint_cache = MTL(ObEncodingHintCache *);
+    if (encoder->get_previous_encodings().count() != data_store_desc_->row_column_count_) {
+      // no micro block built
+    } else if (OB_ISNULL(hint_cache)) {
+      // not a tenant thread, no hint
+    } else if (OB_FAIL(hint_cache->put(data_store_desc_->tablet_id_,
+                                       data_store_desc_->schema_version_,
+                                       encoder->get_previous_encodings()))) {
+      STORAGE_LOG(WARN, "fail to save encoding hint", K(ret), KPC_(data_store_desc));
+    }
+  }
+}
+
 int ObMacroBlockWriter::check_order(const ObDatumRow &row)
 {
   int ret = OB_SUCCESS;
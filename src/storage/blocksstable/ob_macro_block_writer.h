@@ -117,6 +117,8 @@ public:
 private:
   int append_row(const ObDatumRow &row, const int64_t split_size);
   int check_order(const ObDatumRow &row);
+  void load_encoding_hint();
+  void save_encoding_hint();
   int build_micro_block();
   int build_micro_block_desc(
       const ObMicroBlock &micro_block,
@@ -778,9 +778,15 @@ int ObDataMicroBlockCache::prefetch(
     callback.tablet_handle_ = tablet_handle;
     callback.need_write_extra_buf_ = idx_header->is_data_index()
         && ObStoreFormat::is_row_store_type_with_encoding(idx_header->get_row_store_type());
-    if (OB_FAIL(ObIMicroBlockCache::prefetch(
+    ObMicroBlockCacheKey key(tenant_id, macro_id,
+                             idx_header->get_block_offset(), idx_header->get_block_size());
+    if (OB_SUCC(inflight_io_map_.get(key, macro_handle))) {
+      // another scan is reading this micro block, wait on its IO
+    } else if (OB_FAIL(ObIMicroBlockCache::prefetch(
         tenant_id, macro_id, *idx_header, flag, macro_handle, callback))) {
       LOG_WARN("Fail to prefetch data micro block", K(ret));
+    } else {
+      inflight_io_map_.set(key, macro_handle);
     }
   }
   return ret;
@@ -863,10 +869,69 @@ int ObDataMicroBlockCache::get_allocator(common::ObIAllocator *&allocator)
 
 void ObDataMicroBlockCache::destroy()
 {
+  inflight_io_map_.reset();
   common::ObKVCache<ObMicroBlockCacheKey, ObMicroBlockCacheValue>::destroy();
   allocator_.destroy();
 }
 
+int ObDataMicroBlockCache::ObInflightIOMap::get(
+    const ObMicroBlockCacheKey &key,
+    ObMacroBlockHandle &macro_handle)
+{
+  int ret = OB_ENTRY_NOT_EXIST;
+  Slot &slot = slots_[key.hash() % SLOT_CNT];
+  ObSpinLockGuard guard(slot.lock_);
+  if (!slot.macro_handle_.is_valid()) {
+  } else if (slot.macro_handle_.get_io_handle().is_finished()) {
+    // the finished block is in block cache already, or not worth to be kept
+    slot.macro_handle_.reset();
+  } else if (slot.key_ == key) {
+    macro_handle = slot.macro_handle_;
+    ret = OB_SUCCESS;
+  }
+  return ret;
+}
+
+void ObDataMicroBlockCache::ObInflightIOMap::set(
+    const ObMicroBlockCacheKey &key,
+    const ObMacroBlockHandle &macro_handle)
+{
+  Slot &slot = slots_[key.hash() % SLOT_CNT];
+  ObSpinLockGuard guard(slot.lock_);
+  slot.key_ = key;
+  slot.macro_handle_ = macro_handle;
+}
+
+void ObDataMicroBlockCache::ObInflightIOMap::erase_finished(const ObMicroBlockCacheKey &key)
+{
+  Slot &slot = slots_[key.hash() % SLOT_CNT];
+  ObSpinLockGuard guard(slot.lock_);
+  // the slot may be taken by a newer IO of the same key, which must stay
+  if (slot.macro_handle_.is_valid()
+      && slot.key_ == key
+      && slot.macro_handle_.get_io_handle().is_finished()) {
+    slot.macro_handle_.reset();
+  }
+}
+
+void ObDataMicroBlockCache::ObInflightIOMap::clear(const uint64_t tenant_id)
+{
+  for (int64_t i = 0; i < SLOT_CNT; ++i) {
+    ObSpinLockGuard guard(slots_[i].lock_);
+    if (slots_[i].macro_handle_.is_valid() && tenant_id == slots_[i].key_.get_tenant_id()) {
+      slots_[i].macro_handle_.reset();
+    }
+  }
+}
+
+void ObDataMicroBlockCache::ObInflightIOMap::reset()
+{
+  for (int64_t i = 0; i < SLOT_CNT; ++i) {
+    ObSpinLockGuard guard(slots_[i].lock_);
+    slots_[i].macro_handle_.reset();
+  }
+}
+
 /*-----------------------------------ObDataMicroBlockIOCallback-----------------------------------*/
 ObDataMicroBlockCache::ObDataMicroBlockIOCallback::ObDataMicroBlockIOCallback()
   : ObIMicroBlockIOCallback(),
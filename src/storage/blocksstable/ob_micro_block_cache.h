@@ -20,6 +20,8 @@
 #include "storage/ob_i_table.h"
 #include "storage/blocksstable/ob_micro_block_info.h"
 #include "storage/meta_mem/ob_tablet_handle.h"
+#include "storage/blocksstable/ob_macro_block_handle.h"
+#include "lib/lock/ob_spin_lock.h"
 
 namespace oceanbase
 {
@@ -281,7 +283,34 @@ public:
       ObIAllocator *allocator) override;
   virtual int get_cache(BaseBlockCache *&cache) override;
   virtual int get_allocator(common::ObIAllocator *&allocator) override;
+  void finish_inflight_io(const ObMicroBlockCacheKey &key) { inflight_io_map_.erase_finished(key); }
+  void clear_inflight_io(const uint64_t tenant_id) { inflight_io_map_.clear(tenant_id); }
 public:
+  // Remembers the single data micro block IOs in flight, so that concurrent scans missing
+  // the same micro block share one IO and its decoded block instead of reading it again.
+  class ObInflightIOMap
+  {
+  public:
+    ObInflightIOMap() = default;
+    ~ObInflightIOMap() = default;
+    int get(const ObMicroBlockCacheKey &key, ObMacroBlockHandle &macro_handle);
+    void set(const ObMicroBlockCacheKey &key, const ObMacroBlockHandle &macro_handle);
+    // drop the entry of key once its IO is finished, called by the waiter of the IO
+    void erase_finished(const ObMicroBlockCacheKey &key);
+    // drop all entries of the tenant, no matter whether their IOs are finished
+    void clear(const uint64_t tenant_id);
+    void reset();
+  private:
+    struct Slot
+    {
+      common::ObSpinLock lock_;
+      ObMicroBlockCacheKey key_;
+      ObMacroBlockHandle macro_handle_;
+    };
+    static const int64_t SLOT_CNT = 256;
+    Slot slots_[SLOT_CNT];
+    DISALLOW_COPY_AND_ASSIGN(ObInflightIOMap);
+  };
   class ObDataMicroBlockIOCallback : public ObIMicroBlockIOCallback
   {
   public:
@@ -345,6 +374,7 @@ public:
   };
 private:
   common::ObConcurrentFIFOAllocator allocator_;
+  ObInflightIOMap inflight_io_map_;
   DISALLOW_COPY_AND_ASSIGN(ObDataMicroBlockCache);
 };
 
@@ -153,6 +153,7 @@ void ObMajorPartitionMergeFuser::reset()
   default_row_.reset();
   table_schema_ = NULL;
   generated_cols_.reset();
+  reused_row_ = NULL;
   ObIPartitionMergeFuser::reset();
 }
 
@@ -237,6 +238,14 @@ int ObMajorPartitionMergeFuser::fuse_row(MERGE_ITER_ARRAY &macro_row_iters)
   } else if (OB_UNLIKELY(macro_row_iters.count() <= 0)) {
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "Invalid macro row iters to fuse row", K(macro_row_iters), K(ret));
+  } else if (FALSE_IT(reused_row_ = NULL)) {
+  } else if (1 == macro_row_iters_cnt
+             && OB_NOT_NULL(macro_row_iters.at(0)->get_curr_row())
+             && can_reuse_iter_row(*macro_row_iters.at(0)->get_curr_row())) {
+    // most rows of a major merge come from only one iter and are complete
+    // already, so we skip resetting and copying all the columns of them
+    reused_row_ = macro_row_iters.at(0)->get_curr_row();
+    final_result = true;
   } else {
     nop_pos_.reset();
     reset_store_row(result_row_);
@@ -252,7 +261,8 @@ int ObMajorPartitionMergeFuser::fuse_row(MERGE_ITER_ARRAY &macro_row_iters)
     }
   }
 
-  if (OB_SUCC(ret) && nop_pos_.count() > 0 && result_row_.row_flag_.is_exist_without_delete()) {
+  if (OB_FAIL(ret) || NULL != reused_row_) {
+  } else if (nop_pos_.count() > 0 && result_row_.row_flag_.is_exist_without_delete()) {
     if (generated_cols_.count() > 0) {
       // add defense for generated exprs
       int64_t idx = -1;
@@ -277,13 +287,28 @@ int ObMajorPartitionMergeFuser::fuse_row(MERGE_ITER_ARRAY &macro_row_iters)
     }
   }
 
-  if (OB_SUCC(ret) && result_row_.row_flag_.is_exist_without_delete()) {
+  if (OB_SUCC(ret) && NULL == reused_row_ && result_row_.row_flag_.is_exist_without_delete()) {
     result_row_.row_flag_.reset();
     result_row_.row_flag_.set_flag(ObDmlFlag::DF_INSERT);
   }
   return ret;
 }
 
+// the row can be output without fusing only if the fused result would be the
+// same: an insert row of all the columns without nop, multi version flag and
+// trans id
+bool ObMajorPartitionMergeFuser::can_reuse_iter_row(const ObDatumRow &row) const
+{
+  bool bret = row.row_flag_.is_insert()
+      && 0 == row.mvcc_row_flag_.flag_
+      && !row.trans_id_.is_valid()
+      && column_cnt_ == row.count_;
+  for (int64_t i = 0; bret && i < row.count_; ++i) {
+    bret = !row.storage_datums_[i].is_nop();
+  }
+  return bret;
+}
+
 int ObMajorPartitionMergeFuser::fuse_delete_row(
     ObPartitionMergeIter *row_iter,
     ObDatumRow &row,
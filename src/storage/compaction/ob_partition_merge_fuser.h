@@ -92,15 +92,20 @@ public:
       : ObIPartitionMergeFuser(),
       default_row_(),
       table_schema_(NULL),
-      generated_cols_(allocator_)
+      generated_cols_(allocator_),
+      reused_row_(NULL)
   {}
   virtual ~ObMajorPartitionMergeFuser();
   virtual void reset() override;
   virtual bool is_valid() const override;
   virtual int fuse_row(MERGE_ITER_ARRAY &macro_row_iters) override;
+  virtual inline const blocksstable::ObDatumRow *get_result_row() const override
+  {
+    return NULL != reused_row_ ? reused_row_ : &result_row_;
+  }
   virtual const char *get_fuser_name() const override { return "ObMajorPartitionMergeFuser"; }
   INHERIT_TO_STRING_KV("ObIPartitionMergeFuser", ObIPartitionMergeFuser,
-                       K_(default_row), KP_(table_schema));
+                       K_(default_row), KP_(table_schema), KP_(reused_row));
 protected:
   virtual int inner_check_merge_param(const ObMergeParameter &merge_param);
   virtual int inner_init(const ObMergeParameter &merge_param) override;
@@ -108,10 +113,14 @@ protected:
   virtual int fuse_old_row(ObPartitionMergeIter *row_iter, blocksstable::ObDatumRow *row);
   virtual int fuse_delete_row(ObPartitionMergeIter *row_iter, blocksstable::ObDatumRow &row,
                               const int64_t rowkey_column_cnt) override;
+  virtual bool can_reuse_iter_row(const blocksstable::ObDatumRow &row) const;
 protected:
   blocksstable::ObDatumRow default_row_;
   const share::schema::ObTableSchema *table_schema_;
   ObFixedArray<int32_t, ObIAllocator> generated_cols_;
+  // the current row of the only minimum iter, which is output as the result
+  // row directly without fusing it into result_row_
+  const blocksstable::ObDatumRow *reused_row_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObMajorPartitionMergeFuser);
 };
@@ -126,6 +135,12 @@ public:
       "cur_fuser", "ObBufPartitionMergeFuser");
 protected:
   virtual int inner_check_merge_param(const ObMergeParameter &merge_param) override;
+  // the minor merger sets the multi version flag on the result row
+  virtual bool can_reuse_iter_row(const blocksstable::ObDatumRow &row) const override
+  {
+    UNUSED(row);
+    return false;
+  }
 private:
   DISALLOW_COPY_AND_ASSIGN(ObBufPartitionMergeFuser);
 };
@@ -1003,6 +1003,11 @@ int ObMvccRow::mvcc_write_(ObIMemtableCtx &ctx,
         ObMemtableCtx &mt_ctx = static_cast<ObMemtableCtx &>(ctx);
         if (NULL != mt_ctx.get_trans_ctx()) {
           TX_STAT_READ_ELR_ROW_COUNT_INC(mt_ctx.get_trans_ctx()->get_tenant_id());
+          // the previous writer has not been durable, so we need abort in
+          // cascade if its commit log fails
+          if (writer_node.prev_->get_tx_id() != writer_node.get_tx_id()) {
+            mt_ctx.get_trans_ctx()->add_elr_dependency(writer_node.prev_->get_tx_id());
+          }
         }
       }
     }
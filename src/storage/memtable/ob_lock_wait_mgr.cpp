@@ -99,10 +99,24 @@ ObLockWaitMgr::ObLockWaitMgr(): is_inited_(false),
                                 deadlocked_sessions_index_(0)
 {
   memset(sequence_, 0, sizeof(sequence_));
+  memset(row_waiter_cnt_, 0, sizeof(row_waiter_cnt_));
 }
 
 ObLockWaitMgr::~ObLockWaitMgr() {}
 
+void ObLockWaitMgr::add_row_waiter_cnt_(uint64_t hash, int32_t delta)
+{
+  if (is_rowkey_hash(hash)) {
+    ATOMIC_AAF(&row_waiter_cnt_[(hash >> 1) % LOCK_BUCKET_COUNT], delta);
+  }
+}
+
+bool ObLockWaitMgr::is_hot_row_(uint64_t hash)
+{
+  return is_rowkey_hash(hash)
+    && ATOMIC_LOAD(&row_waiter_cnt_[(hash >> 1) % LOCK_BUCKET_COUNT]) >= HOT_ROW_WAITER_THRESHOLD;
+}
+
 int ObLockWaitMgr::mtl_init(ObLockWaitMgr *&lock_wait_mgr)
 {
   return lock_wait_mgr->init();
@@ -312,6 +326,7 @@ bool ObLockWaitMgr::wait(Node* node)
       while(-EAGAIN == (err = hash_.insert(node)))
         ;
       assert(0 == err);
+      add_row_waiter_cnt_(hash, 1);
 
       // 2. double checkcheck_wakeup_seq
       if (!is_standalone_task && check_wakeup_seq(hash, last_lock_seq, is_standalone_task)) {
@@ -327,6 +342,7 @@ bool ObLockWaitMgr::wait(Node* node)
           wait_succ = true; // maybe repost by checktimeout
           node = NULL;
         } else {
+          add_row_waiter_cnt_(hash, -1);
           node->try_lock_times_--;
         }
       } else {
@@ -402,6 +418,7 @@ ObLockWaitMgr::Node* ObLockWaitMgr::fetch_waiter(uint64_t hash)
           if (0 != err) {
             ret = NULL;
           } else {
+            add_row_waiter_cnt_(hash, -1);
             break;
           }
         }
@@ -528,21 +545,31 @@ void ObLockWaitMgr::retire_node(ObLink*& tail, Node* node)
   while (-EAGAIN == (err = hash_.del(node, tmp_node)))
     ;
   if (0 == err) {
+    add_row_waiter_cnt_(node->hash(), -1);
     node->retire_link_.next_ = tail;
     tail = &node->retire_link_;
   }
 }
 
-void ObLockWaitMgr::delay_header_node_run_ts(const uint64_t hash)
+void ObLockWaitMgr::delay_header_node_run_ts(const uint64_t hash, const bool is_hot_row)
 {
   Node* node = NULL;
   CriticalGuard(get_qs());
   node = hash_.get_next_internal(hash);
   if (NULL != node && !node->is_dummy()) {
-    // delay the execution of the header node by 10ms to ensure that the remote
-    // request can be executed successfully
-    node->update_run_ts(ObTimeUtility::current_time() + 50 * 1000);
-    TRANS_LOG(INFO, "LOCK_MGR: delay header node");
+    const int64_t cur_ts = ObTimeUtility::current_time();
+    if (!is_hot_row) {
+      // delay the execution of the header node by 50ms to ensure that the remote
+      // request can be executed successfully
+      node->update_run_ts(cur_ts + HEADER_NODE_DELAY_US);
+      TRANS_LOG(INFO, "LOCK_MGR: delay header node");
+    } else if (node->get_run_ts() <= cur_ts) {
+      // the remote request still gets its chance on a hot row, but the header node
+      // is delayed shortly and only once until it is due, so the stream of remote
+      // requests can't keep postponing it and the queue on the row keeps moving
+      node->update_run_ts(cur_ts + HOT_ROW_HEADER_NODE_DELAY_US);
+      TRANS_LOG(INFO, "LOCK_MGR: delay header node of hot row");
+    }
   }
 }
 
@@ -576,8 +603,12 @@ int ObLockWaitMgr::post_lock(const int tmp_ret,
         TRANS_LOG(WARN, "recheck lock fail", K(key), K(holder_tx_id));
       } else if (locked) {
         auto hash = wait_on_row ? row_hash : tx_hash;
+        const bool is_hot_row = wait_on_row && is_hot_row_(hash);
+        if (is_hot_row) {
+          EVENT_INC(MEMSTORE_HOT_ROW_CONFLICT_COUNT);
+        }
         if (is_remote_sql && can_elr) {
-          delay_header_node_run_ts(hash);
+          delay_header_node_run_ts(hash, is_hot_row);
         }
         node->set((void*)node,
                 hash,
@@ -186,6 +186,12 @@ public:
 public:
   enum { LOCK_BUCKET_COUNT = 16384};
   static const int64_t OB_SESSPAIR_COUNT = 16;
+  // a row is regarded as hot if so many requests are waiting on it
+  static const int32_t HOT_ROW_WAITER_THRESHOLD = 8;
+  // the header node is delayed for a remote elr request to get the lock
+  static const int64_t HEADER_NODE_DELAY_US = 50 * 1000;
+  // a shorter delay for hot rows, as all the requests queued on the row wait for the header node
+  static const int64_t HOT_ROW_HEADER_NODE_DELAY_US = 5 * 1000;
   typedef ObMemtableKey Key;
   typedef rpc::ObLockWaitNode Node;
   typedef FixedHash2<Node> Hash;
@@ -225,7 +231,7 @@ public:
   // needed. And if so, it will push the request into the lock_wait_mgr based on
   // whether request encounters a conflict and needs to retry
   bool post_process(bool need_retry, bool& need_wait);
-  void delay_header_node_run_ts(const uint64_t hash);
+  void delay_header_node_run_ts(const uint64_t hash, const bool is_hot_row = false);
   // setup the retry parameter on the request
   int post_lock(const int tmp_ret,
                 const ObTabletID &tablet_id,
@@ -328,11 +334,16 @@ private:
   {
     return ATOMIC_LOAD(&sequence_[(hash >> 1) % LOCK_BUCKET_COUNT]);
   }
+  // the waiter count is maintained per bucket for the requests waiting on
+  // rows, so hash collisions may only make a row be regarded as hot earlier
+  void add_row_waiter_cnt_(uint64_t hash, int32_t delta);
+  bool is_hot_row_(uint64_t hash);
 
 private:
   bool is_inited_;
   Hash hash_;
   int64_t sequence_[LOCK_BUCKET_COUNT];
+  int32_t row_waiter_cnt_[LOCK_BUCKET_COUNT];
   char hash_buf_[sizeof(SpHashNode) * LOCK_BUCKET_COUNT];
 
 public:
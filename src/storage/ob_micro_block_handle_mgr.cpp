@@ -80,6 +80,12 @@ int ObMicroBlockDataHandle::get_data_block_data(
       LOG_WARN("Fail to load micro block, ", K(ret), K_(tenant_id), K_(macro_block_id), K_(micro_info));
     }
   }
+  if (ObSSTableMicroBlockState::IN_BLOCK_IO == block_state_ && -1 == block_index_) {
+    // the waited single block io may be shared by concurrent scans, release it from the
+    // in-flight map now instead of pinning its buffer until the slot is reused
+    ObMicroBlockCacheKey key(tenant_id_, macro_block_id_, micro_info_.offset_, micro_info_.size_);
+    ObStorageCacheSuite::get_instance().get_block_cache().finish_inflight_io(key);
+  }
   return ret;
 }
 
@@ -723,6 +723,31 @@ int ObPartTransCtx::one_phase_commit_()
   return ret;
 }
 
+// The dependencies are resolved before the commit log is submitted, the commit
+// logs of the txns in ELR_DEP_UNRESOLVED are before ours in the same ls, so they
+// are durable before ours and the decision can't be changed after that.
+int ObPartTransCtx::check_elr_dependency_before_commit_log_()
+{
+  int ret = OB_SUCCESS;
+  TxELRDepState dep_state = TxELRDepState::ELR_DEP_COMMITTED;
+
+  if (!elr_handler_.has_dependency()) {
+    // do nothing
+  } else if (OB_FAIL(elr_handler_.check_dependency(this, dep_state))) {
+    TRANS_LOG(WARN, "check elr dependency failed", K(ret), KPC(this));
+  } else if (TxELRDepState::ELR_DEP_ABORTED == dep_state) {
+    // the txn has read the data of an early lock released txn which
+    // failed to persist its commit log, so we abort it in cascade
+    if (OB_FAIL(abort_(OB_TRANS_KILLED))) {
+      TRANS_LOG(WARN, "cascade abort for elr dependency failed", K(ret), KPC(this));
+    } else {
+      ret = OB_TRANS_KILLED;
+    }
+  }
+
+  return ret;
+}
+
 int ObPartTransCtx::check_modify_schema_elapsed(
     const ObTabletID &tablet_id,
     const int64_t schema_version)
@@ -2018,6 +2043,14 @@ int ObPartTransCtx::on_failure(ObTxLogCb *log_cb)
       if (is_local_tx_()) {
         if (ObTxLogType::TX_COMMIT_LOG == log_type) {
           sub_state_.clear_state_log_submitting();
+          if (can_elr_ && ObTxData::ELR_COMMIT == ctx_tx_data_.get_state()) {
+            // the locks have been released early while the commit log is not
+            // durable, so the readers and the dependent txns must not treat it
+            // as committed any more
+            if (OB_FAIL(ctx_tx_data_.set_state(ObTxData::RUNNING))) {
+              TRANS_LOG(WARN, "reset elr commit state failed", K(ret), KPC(this));
+            }
+          }
         }
       } else {
         if (ObTxLogType::TX_PREPARE_LOG == log_type) {
@@ -3077,7 +3110,11 @@ int ObPartTransCtx::submit_log_impl_(const ObTxLogType log_type)
       break;
     }
     case ObTxLogType::TX_COMMIT_LOG: {
-      ret = submit_commit_log_();
+      if (is_local_tx_() && OB_FAIL(check_elr_dependency_before_commit_log_())) {
+        TRANS_LOG(WARN, "check elr dependency before commit log failed", K(ret), KPC(this));
+      } else {
+        ret = submit_commit_log_();
+      }
       break;
     }
     case ObTxLogType::TX_ABORT_LOG: {
@@ -5973,9 +6010,14 @@ int ObPartTransCtx::do_local_commit_tx_()
       TRANS_LOG(WARN, "generate commit version failed", KR(ret), K(*this));
     }
   } else if (OB_FAIL(submit_log_impl_(ObTxLogType::TX_COMMIT_LOG))) {
-    // log submitting will retry in handle_timeout
-    TRANS_LOG(WARN, "submit commit log fail, will retry later", KR(ret), KPC(this));
-    ret = OB_SUCCESS;
+    if (OB_TRANS_KILLED == ret) {
+      // aborted in cascade for elr dependency
+      TRANS_LOG(WARN, "txn killed before commit log", KR(ret), KPC(this));
+    } else {
+      // log submitting will retry in handle_timeout
+      TRANS_LOG(WARN, "submit commit log fail, will retry later", KR(ret), KPC(this));
+      ret = OB_SUCCESS;
+    }
   }
 
   return ret;
@@ -6033,6 +6075,8 @@ int ObPartTransCtx::on_local_commit_tx_()
   common::ObTimeGuard tg("part_ctx::on_local_commit", 100 * 1000);
 
   if (!sub_state_.is_gts_waiting()) {
+    // the elr dependencies have been resolved before the commit log is submitted,
+    // see check_elr_dependency_before_commit_log_
     if (OB_UNLIKELY(ctx_tx_data_.get_commit_version() <= 0)) {
       ret = OB_ERR_UNEXPECTED;
       TRANS_LOG(WARN, "invalid commit version", K(ret), KPC(this));
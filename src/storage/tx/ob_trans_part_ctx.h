@@ -136,6 +136,7 @@ public:
              const int64_t &request_id);
   int abort(const int reason);
   int one_phase_commit_();
+  int check_elr_dependency_before_commit_log_();
   int get_prepare_version_if_prepared(bool &is_prepared, int64_t &prepare_version);
   int64_t get_snapshot_version() const;
   int64_t get_commit_version() const { return ctx_tx_data_.get_commit_version(); }
@@ -205,6 +206,7 @@ public:
 
   // for elr
   bool is_can_elr() const { return can_elr_; }
+  void add_elr_dependency(const ObTransID &prev_tx_id) { elr_handler_.add_dependency(prev_tx_id); }
 public:
   // thread safe
   int64_t to_string(char* buf, const int64_t buf_len) const;
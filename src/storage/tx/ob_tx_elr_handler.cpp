@@ -14,16 +14,38 @@
 #include "common/ob_clock_generator.h"
 #include "ob_trans_part_ctx.h"
 #include "ob_trans_service.h"
+#include "storage/tx_table/ob_tx_table.h"
 
 namespace oceanbase
 {
 namespace transaction
 {
 
+// fetch the current state of the txn which releases its locks early, the
+// ELR_COMMIT state is valid here compared to GetTxStateWithLogTSFunctor
+class GetELRTxStateFunctor : public storage::ObITxDataCheckFunctor
+{
+public:
+  explicit GetELRTxStateFunctor(int32_t &state) : state_(state) {}
+  virtual ~GetELRTxStateFunctor() {}
+  virtual int operator()(const storage::ObTxData &tx_data,
+                         storage::ObTxCCCtx *tx_cc_ctx = nullptr) override
+  {
+    UNUSED(tx_cc_ctx);
+    state_ = ATOMIC_LOAD(&tx_data.state_);
+    return OB_SUCCESS;
+  }
+  TO_STRING_KV(K_(state));
+private:
+  int32_t &state_;
+};
+
 void ObTxELRHandler::reset()
 {
   elr_prepared_state_ = TxELRState::ELR_INIT;
   mt_ctx_ = NULL;
+  dep_count_ = 0;
+  dep_overflow_ = false;
 }
 
 int ObTxELRHandler::check_and_early_lock_release(ObPartTransCtx *ctx)
@@ -43,5 +65,96 @@ int ObTxELRHandler::check_and_early_lock_release(ObPartTransCtx *ctx)
   return ret;
 }
 
+void ObTxELRHandler::add_dependency(const ObTransID &prev_tx_id)
+{
+  ObSpinLockGuard guard(dep_lock_);
+  bool found = false;
+  for (int64_t i = 0; !found && i < dep_count_; i++) {
+    found = (dep_tx_ids_[i] == prev_tx_id);
+  }
+  if (found) {
+    // do nothing
+  } else if (dep_count_ >= MAX_ELR_DEPENDENCY_COUNT) {
+    ATOMIC_STORE(&dep_overflow_, true);
+  } else {
+    dep_tx_ids_[dep_count_] = prev_tx_id;
+    ATOMIC_STORE(&dep_count_, dep_count_ + 1);
+  }
+}
+
+TxELRDepState ObTxELRHandler::get_dep_state(const int32_t tx_data_state)
+{
+  TxELRDepState dep_state = TxELRDepState::ELR_DEP_ABORTED;
+  if (storage::ObTxData::COMMIT == tx_data_state) {
+    dep_state = TxELRDepState::ELR_DEP_COMMITTED;
+  } else if (storage::ObTxData::ELR_COMMIT == tx_data_state) {
+    dep_state = TxELRDepState::ELR_DEP_UNRESOLVED;
+  } else {
+    // ABORT, or RUNNING which is reset from ELR_COMMIT after its commit log failed
+    dep_state = TxELRDepState::ELR_DEP_ABORTED;
+  }
+  return dep_state;
+}
+
+int ObTxELRHandler::check_dependency(ObPartTransCtx *ctx, TxELRDepState &dep_state)
+{
+  int ret = OB_SUCCESS;
+  dep_state = TxELRDepState::ELR_DEP_COMMITTED;
+  int64_t dep_count = 0;
+  ObTransID dep_tx_ids[MAX_ELR_DEPENDENCY_COUNT];
+  storage::ObTxTableGuard *tx_table_guard = NULL;
+
+  if (OB_ISNULL(ctx)) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid argument", K(ret), K(*this));
+  } else {
+    // the tx table is not accessed under dep_lock_, add_dependency() is called
+    // by the writers on the rows released early
+    ObSpinLockGuard guard(dep_lock_);
+    dep_count = dep_count_;
+    for (int64_t i = 0; i < dep_count; i++) {
+      dep_tx_ids[i] = dep_tx_ids_[i];
+    }
+    if (dep_overflow_) {
+      // the commit logs of the dependencies not recorded are before ours in the same
+      // ls as the recorded ones, so they are resolved the same way
+      dep_state = TxELRDepState::ELR_DEP_UNRESOLVED;
+    }
+  }
+
+  if (OB_FAIL(ret) || 0 == dep_count) {
+  } else if (OB_ISNULL(tx_table_guard = ctx->mt_ctx_.get_tx_table_guard())
+             || !tx_table_guard->is_valid()) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(WARN, "tx table guard is invalid", K(ret), K(*this));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && TxELRDepState::ELR_DEP_ABORTED != dep_state && i < dep_count; i++) {
+      int32_t state = storage::ObTxData::RUNNING;
+      GetELRTxStateFunctor fn(state);
+      if (OB_FAIL(tx_table_guard->get_tx_table()->check_with_tx_data(dep_tx_ids[i],
+                                                                    fn,
+                                                                    tx_table_guard->epoch()))) {
+        if (OB_TRANS_CTX_NOT_EXIST == ret) {
+          // the tx data has been recycled, so the txn must have been decided
+          // and committed before the recycle point
+          ret = OB_SUCCESS;
+        } else {
+          TRANS_LOG(WARN, "check elr dependency failed", K(ret), K(dep_tx_ids[i]), K(*this));
+        }
+      } else {
+        const TxELRDepState curr_dep_state = get_dep_state(state);
+        if (curr_dep_state > dep_state) {
+          dep_state = curr_dep_state;
+        }
+        if (TxELRDepState::ELR_DEP_ABORTED == curr_dep_state) {
+          TRANS_LOG(INFO, "elr dependency aborted", "dep_tx_id", dep_tx_ids[i], K(state),
+                    "trans_id", ctx->get_trans_id(), K(*this));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 } //transaction
 } //oceanbase
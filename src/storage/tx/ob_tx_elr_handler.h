@@ -14,6 +14,7 @@
 #define OCEANBASE_TX_ELR_HANDLER_
 
 #include "ob_trans_define.h"
+#include "lib/lock/ob_spin_lock.h"
 
 namespace oceanbase
 {
@@ -36,13 +37,34 @@ enum TxELRState
   ELR_PREPARED = 2
 };
 
+// the resolved state of the txns whose early released locks are held by us
+enum TxELRDepState
+{
+  // all of them have committed
+  ELR_DEP_COMMITTED = 0,
+  // some of them are still ELR_COMMIT, their commit logs are submitted before
+  // ours in the same ls, so our commit log can only be durable after theirs
+  ELR_DEP_UNRESOLVED = 1,
+  // some of them are aborted or their commit logs failed, or we can't tell
+  ELR_DEP_ABORTED = 2
+};
+
 class ObTxELRHandler
 {
 public:
-  ObTxELRHandler() : elr_prepared_state_(ELR_INIT), mt_ctx_(NULL) {}
+  ObTxELRHandler() : elr_prepared_state_(ELR_INIT), mt_ctx_(NULL),
+                     dep_lock_(), dep_count_(0), dep_overflow_(false) {}
   void reset();
 
   int check_and_early_lock_release(ObPartTransCtx *ctx);
+  // the txn writes on a row whose lock has been released early by PREV_TX_ID,
+  // so it depends on the commit of PREV_TX_ID
+  void add_dependency(const ObTransID &prev_tx_id);
+  bool has_dependency() const { return ATOMIC_LOAD(&dep_count_) > 0; }
+  // resolve the state of the txns we depend on, the txn should be aborted in
+  // cascade if it's ELR_DEP_ABORTED. Called before the commit log is submitted.
+  int check_dependency(ObPartTransCtx *ctx, TxELRDepState &dep_state);
+  static TxELRDepState get_dep_state(const int32_t tx_data_state);
   void set_memtable_ctx(memtable::ObMemtableCtx *mt_ctx) { mt_ctx_ = mt_ctx; }
   memtable::ObMemtableCtx *get_memtable_ctx() const { return mt_ctx_; }
 
@@ -50,11 +72,20 @@ public:
   void set_elr_prepared() { ATOMIC_STORE(&elr_prepared_state_, TxELRState::ELR_PREPARED); }
   bool is_elr_prepared() const { return TxELRState::ELR_PREPARED == ATOMIC_LOAD(&elr_prepared_state_); }
   void reset_elr_state() { ATOMIC_STORE(&elr_prepared_state_, TxELRState::ELR_INIT); }
-  TO_STRING_KV(K_(elr_prepared_state), KP_(mt_ctx));
+  TO_STRING_KV(K_(elr_prepared_state), KP_(mt_ctx), K_(dep_count), K_(dep_overflow));
+private:
+  static const int64_t MAX_ELR_DEPENDENCY_COUNT = 8;
 private:
   // whether it is ready for elr
   TxELRState elr_prepared_state_;
   memtable::ObMemtableCtx *mt_ctx_;
+  // txns whose early released locks are held by us now
+  common::ObSpinLock dep_lock_;
+  int64_t dep_count_;
+  ObTransID dep_tx_ids_[MAX_ELR_DEPENDENCY_COUNT];
+  // the dependencies exceed MAX_ELR_DEPENDENCY_COUNT, the ones not recorded
+  // can't be checked, so the txn is at least ELR_DEP_UNRESOLVED
+  bool dep_overflow_;
 };
 
 } // transaction
@@ -0,0 +1,243 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * Test ObLogFileStoreService
+ * 1. put/get/del/del_range of the default and the tenant column families
+ * 2. a sealed segment file is unlinked once all the values in it are deleted or overwritten
+ */
+
+#define USING_LOG_PREFIX OBLOG
+
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include "share/ob_define.h"
+#define private public
+#include "logservice/libobcdc/src/ob_log_file_store_service.h"
+#undef private
+
+using namespace oceanbase;
+using namespace common;
+using namespace libobcdc;
+
+namespace oceanbase
+{
+namespace unittest
+{
+class TestObLogFileStoreService : public ::testing::Test
+{
+public:
+  static constexpr const char *STORE_PATH = "./test_ob_log_file_store_service_dir";
+  static const int64_t SEGMENT_SIZE = 4096;
+  static const int64_t VALUE_SIZE = 1000;
+  // values per segment
+  static const int64_t SEGMENT_VALUE_CNT = SEGMENT_SIZE / VALUE_SIZE;
+
+  virtual void SetUp() override
+  {
+    ASSERT_EQ(OB_SUCCESS, store_.init(STORE_PATH));
+    // use small segments to cover segment switch and reclaim
+    store_.segment_size_ = SEGMENT_SIZE;
+  }
+  virtual void TearDown() override
+  {
+    store_.destroy();
+  }
+
+  static std::string make_key(const int64_t idx)
+  {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "key_%05ld", idx);
+    return std::string(buf);
+  }
+  static std::string make_value(const int64_t idx, const int64_t len = VALUE_SIZE)
+  {
+    return std::string(len, static_cast<char>('a' + idx % 26));
+  }
+  int put(void *cf_handle, const int64_t idx, const int64_t len = VALUE_SIZE)
+  {
+    const std::string value = make_value(idx, len);
+    return store_.put(cf_handle, make_key(idx), ObSlice(value.c_str(), value.size()));
+  }
+  bool segment_exist(void *cf_handle, const int64_t seg_id)
+  {
+    std::string path;
+    store_.get_segment_path_(static_cast<ObLogFileStoreService::ColumnFamily *>(cf_handle)->cf_id_,
+        seg_id, path);
+    return 0 == ::access(path.c_str(), F_OK);
+  }
+  int64_t disk_usage(void *cf_handle)
+  {
+    return static_cast<ObLogFileStoreService::ColumnFamily *>(cf_handle)->disk_usage_;
+  }
+
+protected:
+  ObLogFileStoreService store_;
+};
+
+TEST_F(TestObLogFileStoreService, put_get_del)
+{
+  void *cf = store_.default_cf_;
+  std::string value;
+
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, store_.get(make_key(0), value));
+  for (int64_t idx = 0; idx < 10; ++idx) {
+    ASSERT_EQ(OB_SUCCESS, put(cf, idx));
+  }
+  for (int64_t idx = 0; idx < 10; ++idx) {
+    ASSERT_EQ(OB_SUCCESS, store_.get(make_key(idx), value));
+    ASSERT_EQ(make_value(idx), value);
+  }
+
+  // overwrite with a value of another length
+  ASSERT_EQ(OB_SUCCESS, put(cf, 3, 10));
+  ASSERT_EQ(OB_SUCCESS, store_.get(make_key(3), value));
+  ASSERT_EQ(make_value(3, 10), value);
+
+  ASSERT_EQ(OB_SUCCESS, store_.del(make_key(3)));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, store_.get(make_key(3), value));
+  // deleting a non-exist key is not an error
+  ASSERT_EQ(OB_SUCCESS, store_.del(make_key(3)));
+  ASSERT_EQ(OB_SUCCESS, store_.get(make_key(4), value));
+  ASSERT_EQ(make_value(4), value);
+
+  // empty value is invalid
+  ASSERT_EQ(OB_INVALID_ARGUMENT, store_.put(make_key(100), ObSlice()));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, store_.get(NULL, make_key(0), value));
+}
+
+TEST_F(TestObLogFileStoreService, batch_write_and_del_range)
+{
+  void *cf = store_.default_cf_;
+  std::vector<std::string> keys;
+  std::vector<std::string> values;
+  std::vector<ObSlice> slices;
+  std::string value;
+
+  for (int64_t idx = 0; idx < 20; ++idx) {
+    keys.push_back(make_key(idx));
+    values.push_back(make_value(idx));
+  }
+  for (int64_t idx = 0; idx < 20; ++idx) {
+    slices.push_back(ObSlice(values[idx].c_str(), values[idx].size()));
+  }
+  ASSERT_EQ(OB_SUCCESS, store_.batch_write(cf, keys, slices));
+  slices.pop_back();
+  ASSERT_EQ(OB_INVALID_ARGUMENT, store_.batch_write(cf, keys, slices));
+
+  // [key_00005, key_00010)
+  ASSERT_EQ(OB_SUCCESS, store_.del_range(cf, make_key(5), make_key(10)));
+  for (int64_t idx = 0; idx < 20; ++idx) {
+    if (idx >= 5 && idx < 10) {
+      ASSERT_EQ(OB_ENTRY_NOT_EXIST, store_.get(make_key(idx), value));
+    } else {
+      ASSERT_EQ(OB_SUCCESS, store_.get(make_key(idx), value));
+      ASSERT_EQ(make_value(idx), value);
+    }
+  }
+  // an empty range deletes nothing
+  ASSERT_EQ(OB_SUCCESS, store_.del_range(cf, make_key(12), make_key(12)));
+  ASSERT_EQ(OB_SUCCESS, store_.get(make_key(12), value));
+  ASSERT_EQ(OB_SUCCESS, store_.del_range(cf, make_key(0), make_key(100)));
+  ASSERT_TRUE(static_cast<ObLogFileStoreService::ColumnFamily *>(cf)->index_.empty());
+}
+
+TEST_F(TestObLogFileStoreService, segment_reclaim)
+{
+  void *cf = store_.default_cf_;
+  const int64_t segment_cnt = 5;
+  const int64_t value_cnt = segment_cnt * SEGMENT_VALUE_CNT;
+
+  for (int64_t idx = 0; idx < value_cnt; ++idx) {
+    ASSERT_EQ(OB_SUCCESS, put(cf, idx));
+  }
+  for (int64_t seg_id = 0; seg_id < segment_cnt; ++seg_id) {
+    ASSERT_TRUE(segment_exist(cf, seg_id));
+  }
+  ASSERT_EQ(segment_cnt * SEGMENT_SIZE, disk_usage(cf));
+
+  // a sealed segment stays until its last value is deleted
+  for (int64_t idx = 0; idx < SEGMENT_VALUE_CNT - 1; ++idx) {
+    ASSERT_EQ(OB_SUCCESS, store_.del(make_key(idx)));
+  }
+  ASSERT_TRUE(segment_exist(cf, 0));
+  ASSERT_EQ(OB_SUCCESS, store_.del(make_key(SEGMENT_VALUE_CNT - 1)));
+  ASSERT_FALSE(segment_exist(cf, 0));
+  ASSERT_EQ((segment_cnt - 1) * SEGMENT_SIZE, disk_usage(cf));
+
+  // overwritten values release their segment too
+  for (int64_t idx = SEGMENT_VALUE_CNT; idx < 2 * SEGMENT_VALUE_CNT; ++idx) {
+    ASSERT_EQ(OB_SUCCESS, put(cf, idx, 10));
+  }
+  ASSERT_FALSE(segment_exist(cf, 1));
+
+  // the active segment is kept even if it's empty
+  ASSERT_EQ(OB_SUCCESS, store_.del_range(cf, make_key(0), make_key(value_cnt)));
+  for (int64_t seg_id = 0; seg_id < segment_cnt - 1; ++seg_id) {
+    ASSERT_FALSE(segment_exist(cf, seg_id));
+  }
+  ASSERT_TRUE(segment_exist(cf, segment_cnt - 1));
+  ASSERT_TRUE(SEGMENT_SIZE == disk_usage(cf));
+
+  // a value larger than segment size owns a segment
+  std::string value;
+  ASSERT_EQ(OB_SUCCESS, put(cf, 0, 3 * SEGMENT_SIZE));
+  ASSERT_EQ(OB_SUCCESS, store_.get(make_key(0), value));
+  ASSERT_EQ(make_value(0, 3 * SEGMENT_SIZE), value);
+  ASSERT_EQ(OB_SUCCESS, store_.del(make_key(0)));
+  // the full active segment is sealed and unlinked, the large one becomes active
+  ASSERT_FALSE(segment_exist(cf, segment_cnt - 1));
+  ASSERT_TRUE(segment_exist(cf, segment_cnt));
+  ASSERT_EQ(SEGMENT_SIZE * 3, disk_usage(cf));
+}
+
+TEST_F(TestObLogFileStoreService, column_family)
+{
+  void *cf1 = NULL;
+  void *cf2 = NULL;
+  std::string value;
+
+  ASSERT_EQ(OB_SUCCESS, store_.create_column_family("tenant_1001", cf1));
+  ASSERT_EQ(OB_SUCCESS, store_.create_column_family("tenant_1002", cf2));
+  for (int64_t idx = 0; idx < 10; ++idx) {
+    ASSERT_EQ(OB_SUCCESS, put(cf1, idx));
+    ASSERT_EQ(OB_SUCCESS, put(cf2, idx + 1));
+  }
+  for (int64_t idx = 0; idx < 10; ++idx) {
+    ASSERT_EQ(OB_SUCCESS, store_.get(cf1, make_key(idx), value));
+    ASSERT_EQ(make_value(idx), value);
+    ASSERT_EQ(OB_SUCCESS, store_.get(cf2, make_key(idx), value));
+    ASSERT_EQ(make_value(idx + 1), value);
+  }
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, store_.get(make_key(0), value));
+
+  // a column family must be dropped before destroyed
+  ASSERT_EQ(OB_STATE_NOT_MATCH, store_.destory_column_family(cf1));
+  ASSERT_EQ(OB_SUCCESS, store_.drop_column_family(cf1));
+  ASSERT_EQ(0, disk_usage(cf1));
+  ASSERT_EQ(OB_SUCCESS, store_.destory_column_family(cf1));
+
+  ASSERT_EQ(OB_SUCCESS, store_.get(cf2, make_key(9), value));
+  ASSERT_EQ(make_value(10), value);
+  ASSERT_EQ(OB_SUCCESS, store_.drop_column_family(cf2));
+  ASSERT_EQ(OB_SUCCESS, store_.destory_column_family(cf2));
+}
+
+} // end of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_log_file_store_service.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
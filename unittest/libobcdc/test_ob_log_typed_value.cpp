@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "libobcdc.h"                     // ObCDCTypedValue
+#include "ob_log_part_trans_task.h"       // ColValue, DmlStmtTask
+#include "lib/allocator/page_arena.h"     // ObArenaAllocator
+
+using namespace oceanbase::common;
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+
+TEST(ObCDCTypedValue, fixed_length_value)
+{
+  ColValue cv;
+  ObCDCTypedValue typed_value;
+
+  cv.reset();
+  cv.column_id_ = 16;
+  cv.value_.set_int(-12345);
+  cv.to_typed_value(typed_value);
+  EXPECT_EQ(16U, typed_value.column_id_);
+  EXPECT_EQ(static_cast<uint8_t>(ObIntType), typed_value.obj_type_);
+  EXPECT_TRUE(typed_value.has_value_);
+  EXPECT_FALSE(typed_value.is_null_);
+  EXPECT_FALSE(typed_value.is_out_row_);
+  EXPECT_EQ(-12345, typed_value.value_.int64_);
+
+  cv.value_.set_double(3.5);
+  cv.to_typed_value(typed_value);
+  EXPECT_EQ(static_cast<uint8_t>(ObDoubleType), typed_value.obj_type_);
+  EXPECT_EQ(3.5, typed_value.value_.double_);
+
+  cv.value_.set_null();
+  cv.to_typed_value(typed_value);
+  EXPECT_TRUE(typed_value.has_value_);
+  EXPECT_TRUE(typed_value.is_null_);
+}
+
+TEST(ObCDCTypedValue, var_length_value)
+{
+  ObArenaAllocator allocator;
+  ColValue cv;
+  ObCDCTypedValue typed_value;
+  const char *str = "typed column value";
+
+  cv.reset();
+  cv.column_id_ = 17;
+  cv.value_.set_varchar(str, static_cast<int32_t>(strlen(str)));
+  cv.value_.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+  cv.to_typed_value(typed_value);
+  EXPECT_EQ(static_cast<uint8_t>(ObVarcharType), typed_value.obj_type_);
+  EXPECT_EQ(static_cast<uint8_t>(CS_TYPE_UTF8MB4_BIN), typed_value.collation_type_);
+  EXPECT_EQ(strlen(str), typed_value.len_);
+  // not copied, refers to the value of the redo log
+  EXPECT_EQ(str, typed_value.value_.ptr_);
+  // and not converted to string
+  EXPECT_TRUE(cv.string_value_.empty());
+
+  number::ObNumber nmb;
+  ASSERT_EQ(OB_SUCCESS, nmb.from("-1234.5678", allocator));
+  cv.value_.set_number(nmb);
+  cv.to_typed_value(typed_value);
+  EXPECT_EQ(static_cast<uint8_t>(ObNumberType), typed_value.obj_type_);
+  EXPECT_EQ(nmb.get_desc_value(), typed_value.len_);
+  EXPECT_EQ(reinterpret_cast<const char *>(nmb.get_digits()), typed_value.value_.ptr_);
+
+  // the digits and desc can be read back as the number
+  number::ObNumber typed_nmb(typed_value.len_,
+      reinterpret_cast<uint32_t *>(const_cast<char *>(typed_value.value_.ptr_)));
+  EXPECT_EQ(0, typed_nmb.compare(nmb));
+
+  cv.is_out_row_ = 1;
+  cv.to_typed_value(typed_value);
+  EXPECT_TRUE(typed_value.is_out_row_);
+}
+
+TEST(ObCDCTypedValue, dml_stmt_task)
+{
+  ObArenaAllocator allocator;
+  PartTransTask host;
+  ObLogEntryTask log_entry_task;
+  MutatorRow row(allocator);
+  DmlStmtTask stmt_task(host, log_entry_task, row);
+  ObCDCTypedValue new_cols[2];
+  ObCDCTypedValue old_cols[2];
+
+  EXPECT_TRUE(NULL == stmt_task.get_typed_new_cols());
+  EXPECT_TRUE(NULL == stmt_task.get_typed_old_cols());
+  EXPECT_EQ(0, stmt_task.get_typed_column_cnt());
+
+  stmt_task.set_typed_cols(new_cols, old_cols, 2);
+  EXPECT_EQ(new_cols, stmt_task.get_typed_new_cols());
+  EXPECT_EQ(old_cols, stmt_task.get_typed_old_cols());
+  EXPECT_EQ(2, stmt_task.get_typed_column_cnt());
+
+  // not kept by a reused stmt task
+  stmt_task.reset();
+  EXPECT_TRUE(NULL == stmt_task.get_typed_new_cols());
+  EXPECT_TRUE(NULL == stmt_task.get_typed_old_cols());
+  EXPECT_EQ(0, stmt_task.get_typed_column_cnt());
+}
+
+} // namespace libobcdc
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_ob_log_typed_value.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
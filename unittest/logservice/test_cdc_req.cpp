@@ -0,0 +1,341 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/oblog/ob_log.h"
+#include "lib/random/ob_random.h"
+#include "lib/utility/ob_unify_serialize.h"
+#include "share/ob_errno.h"
+#define private public
+#include "logservice/cdcservice/ob_cdc_req.h"
+#undef private
+
+namespace oceanbase
+{
+using namespace common;
+using namespace obrpc;
+namespace unittest
+{
+// The fetch log request of the CDC Connector of old version, without compressor_type_
+class OldFetchLogReq
+{
+public:
+  OldFetchLogReq() : rpc_ver_(1), ls_id_(), start_lsn_(), upper_limit_ts_(0), client_pid_(0) {}
+  OB_UNIS_VERSION(1);
+public:
+  int64_t rpc_ver_;
+  ObLSID ls_id_;
+  LSN start_lsn_;
+  int64_t upper_limit_ts_;
+  uint64_t client_pid_;
+};
+OB_SERIALIZE_MEMBER(OldFetchLogReq, rpc_ver_, ls_id_, start_lsn_, upper_limit_ts_, client_pid_);
+
+// The fetch log response of the observer of old version, without compressor_type_ and raw_size_
+class OldFetchLogResp
+{
+public:
+  static const int64_t BUF_LEN = 256 * 1024L;
+  OldFetchLogResp()
+    : rpc_ver_(1), err_(OB_SUCCESS), debug_err_(OB_SUCCESS), ls_id_(),
+      feedback_type_(ObCdcLSFetchLogResp::INVALID_FEEDBACK), fetch_status_(),
+      next_req_lsn_(), log_num_(0), pos_(0)
+  {
+    log_entry_buf_[0] = '\0';
+  }
+  OB_UNIS_VERSION(1);
+public:
+  int64_t rpc_ver_;
+  int err_;
+  int debug_err_;
+  ObLSID ls_id_;
+  ObCdcLSFetchLogResp::FeedbackType feedback_type_;
+  ObCdcFetchStatus fetch_status_;
+  LSN next_req_lsn_;
+  int64_t log_num_;
+  int64_t pos_;
+  char log_entry_buf_[BUF_LEN];
+};
+
+OB_DEF_SERIALIZE(OldFetchLogResp)
+{
+  int ret = OB_SUCCESS;
+  LST_DO_CODE(OB_UNIS_ENCODE, rpc_ver_, err_, debug_err_,
+              ls_id_, feedback_type_, fetch_status_, next_req_lsn_, log_num_, pos_);
+  if (OB_SUCCESS == ret && pos_ > 0) {
+    if (buf_len - pos < pos_) {
+      ret = OB_BUF_NOT_ENOUGH;
+    } else {
+      MEMCPY(buf + pos, log_entry_buf_, pos_);
+      pos += pos_;
+    }
+  }
+  return ret;
+}
+
+OB_DEF_SERIALIZE_SIZE(OldFetchLogResp)
+{
+  int64_t len = 0;
+  LST_DO_CODE(OB_UNIS_ADD_LEN, rpc_ver_, err_, debug_err_,
+              ls_id_, feedback_type_, fetch_status_, next_req_lsn_, log_num_, pos_);
+  len += pos_;
+  return len;
+}
+
+OB_DEF_DESERIALIZE(OldFetchLogResp)
+{
+  int ret = OB_SUCCESS;
+  LST_DO_CODE(OB_UNIS_DECODE, rpc_ver_, err_, debug_err_,
+              ls_id_, feedback_type_, fetch_status_, next_req_lsn_, log_num_, pos_);
+  if (OB_FAIL(ret)) {
+  } else if (pos_ < 0 || pos_ > BUF_LEN || data_len - pos < pos_) {
+    ret = OB_DESERIALIZE_ERROR;
+  } else if (pos_ > 0) {
+    MEMCPY(log_entry_buf_, buf + pos, pos_);
+    pos += pos_;
+  }
+  return ret;
+}
+
+static const int64_t LOG_SIZE = 128 * 1024L;
+
+class TestCdcReq : public ::testing::Test
+{
+public:
+  TestCdcReq() : log_data_(NULL), buf_(NULL), buf_len_(0) {}
+  virtual void SetUp() override
+  {
+    log_data_ = new char[LOG_SIZE];
+    // compressible as the redo of the rows of the same table
+    for (int64_t i = 0; i < LOG_SIZE; i++) {
+      log_data_[i] = static_cast<char>('a' + (i % 64) / 8);
+    }
+    buf_len_ = 2 * LOG_SIZE;
+    buf_ = new char[buf_len_];
+  }
+  virtual void TearDown() override
+  {
+    delete [] log_data_;
+    delete [] buf_;
+  }
+  // fill the response as ObCdcFetcher does
+  void fill_resp(const char *data, const int64_t size, ObCdcLSFetchLogResp &resp)
+  {
+    int64_t remain_size = 0;
+    char *remain_buf = resp.get_remain_buf(remain_size);
+    ASSERT_TRUE(size <= remain_size);
+    MEMCPY(remain_buf, data, size);
+    resp.log_entry_filled(size);
+    resp.set_ls_id(ObLSID(1001));
+    resp.set_next_req_lsn(LSN(size));
+    resp.set_err(OB_SUCCESS);
+    resp.set_debug_err(OB_SUCCESS);
+  }
+  // send the response as rpc does, and receive it as the CDC Connector does
+  void send_resp(const ObCdcLSFetchLogResp &resp, ObCdcLSFetchLogResp &recv_resp,
+                 ObCdcLSFetchLogResp &result)
+  {
+    int64_t pos = 0;
+    const int64_t size = resp.get_serialize_size();
+    ASSERT_TRUE(size <= buf_len_);
+    ASSERT_EQ(OB_SUCCESS, resp.serialize(buf_, buf_len_, pos));
+    ASSERT_EQ(size, pos);
+    pos = 0;
+    ASSERT_EQ(OB_SUCCESS, recv_resp.deserialize(buf_, size, pos));
+    ASSERT_EQ(size, pos);
+    ASSERT_EQ(OB_SUCCESS, result.assign(recv_resp));
+  }
+protected:
+  char *log_data_;
+  char *buf_;
+  int64_t buf_len_;
+};
+
+TEST_F(TestCdcReq, compress_round_trip)
+{
+  const ObCompressorType types[] = { LZ4_COMPRESSOR, ZSTD_1_3_8_COMPRESSOR };
+  for (int64_t i = 0; i < ARRAYSIZEOF(types); i++) {
+    ObCdcLSFetchLogResp *resp = new ObCdcLSFetchLogResp();
+    ObCdcLSFetchLogResp *recv_resp = new ObCdcLSFetchLogResp();
+    ObCdcLSFetchLogResp *result = new ObCdcLSFetchLogResp();
+    fill_resp(log_data_, LOG_SIZE, *resp);
+    ASSERT_EQ(OB_SUCCESS, resp->compress(types[i]));
+    EXPECT_TRUE(resp->is_compressed());
+    EXPECT_EQ(types[i], resp->compressor_type_);
+    EXPECT_EQ(LOG_SIZE, resp->raw_size_);
+    EXPECT_GT(LOG_SIZE, resp->get_pos());
+    // compressed only once
+    const int64_t compressed_size = resp->get_pos();
+    ASSERT_EQ(OB_SUCCESS, resp->compress(types[i]));
+    EXPECT_EQ(compressed_size, resp->get_pos());
+
+    send_resp(*resp, *recv_resp, *result);
+    EXPECT_TRUE(recv_resp->is_compressed());
+    EXPECT_EQ(compressed_size, recv_resp->get_pos());
+    EXPECT_FALSE(result->is_compressed());
+    EXPECT_EQ(1, result->get_log_num());
+    EXPECT_EQ(LSN(LOG_SIZE), result->get_next_req_lsn());
+    EXPECT_EQ(ObLSID(1001), result->get_ls_id());
+    ASSERT_EQ(LOG_SIZE, result->get_pos());
+    EXPECT_EQ(0, MEMCMP(log_data_, result->get_log_entry_buf(), LOG_SIZE));
+    delete resp;
+    delete recv_resp;
+    delete result;
+  }
+}
+
+TEST_F(TestCdcReq, skip_compress)
+{
+  ObCdcLSFetchLogResp *resp = new ObCdcLSFetchLogResp();
+  ObCdcLSFetchLogResp *recv_resp = new ObCdcLSFetchLogResp();
+  ObCdcLSFetchLogResp *result = new ObCdcLSFetchLogResp();
+  // small response
+  const int64_t small_size = 1024;
+  fill_resp(log_data_, small_size, *resp);
+  ASSERT_EQ(OB_SUCCESS, resp->compress(LZ4_COMPRESSOR));
+  EXPECT_FALSE(resp->is_compressed());
+  EXPECT_EQ(small_size, resp->get_pos());
+  send_resp(*resp, *recv_resp, *result);
+  ASSERT_EQ(small_size, result->get_pos());
+  EXPECT_EQ(0, MEMCMP(log_data_, result->get_log_entry_buf(), small_size));
+
+  // incompressible response
+  resp->reset();
+  for (int64_t i = 0; i < LOG_SIZE; i++) {
+    log_data_[i] = static_cast<char>(ObRandom::rand(0, 255));
+  }
+  fill_resp(log_data_, LOG_SIZE, *resp);
+  ASSERT_EQ(OB_SUCCESS, resp->compress(LZ4_COMPRESSOR));
+  EXPECT_FALSE(resp->is_compressed());
+  EXPECT_EQ(LOG_SIZE, resp->get_pos());
+  EXPECT_EQ(0, MEMCMP(log_data_, resp->get_log_entry_buf(), LOG_SIZE));
+  send_resp(*resp, *recv_resp, *result);
+  ASSERT_EQ(LOG_SIZE, result->get_pos());
+  EXPECT_EQ(0, MEMCMP(log_data_, result->get_log_entry_buf(), LOG_SIZE));
+
+  // the CDC Connector doesn't ask for compression
+  resp->reset();
+  fill_resp(log_data_, LOG_SIZE, *resp);
+  ASSERT_EQ(OB_SUCCESS, resp->compress(NONE_COMPRESSOR));
+  EXPECT_FALSE(resp->is_compressed());
+  delete resp;
+  delete recv_resp;
+  delete result;
+}
+
+TEST_F(TestCdcReq, truncated_resp)
+{
+  ObCdcLSFetchLogResp *resp = new ObCdcLSFetchLogResp();
+  ObCdcLSFetchLogResp *recv_resp = new ObCdcLSFetchLogResp();
+  fill_resp(log_data_, LOG_SIZE, *resp);
+  ASSERT_EQ(OB_SUCCESS, resp->compress(LZ4_COMPRESSOR));
+  int64_t pos = 0;
+  const int64_t size = resp->get_serialize_size();
+  ASSERT_EQ(OB_SUCCESS, resp->serialize(buf_, buf_len_, pos));
+  pos = 0;
+  EXPECT_NE(OB_SUCCESS, recv_resp->deserialize(buf_, size - 1, pos));
+  delete resp;
+  delete recv_resp;
+}
+
+TEST_F(TestCdcReq, compatible_with_old_observer)
+{
+  OldFetchLogResp *old_resp = new OldFetchLogResp();
+  ObCdcLSFetchLogResp *recv_resp = new ObCdcLSFetchLogResp();
+  ObCdcLSFetchLogResp *result = new ObCdcLSFetchLogResp();
+  old_resp->ls_id_ = ObLSID(1001);
+  old_resp->next_req_lsn_ = LSN(LOG_SIZE);
+  old_resp->log_num_ = 1;
+  old_resp->pos_ = LOG_SIZE;
+  MEMCPY(old_resp->log_entry_buf_, log_data_, LOG_SIZE);
+
+  int64_t pos = 0;
+  const int64_t size = old_resp->get_serialize_size();
+  ASSERT_TRUE(size <= buf_len_);
+  ASSERT_EQ(OB_SUCCESS, old_resp->serialize(buf_, buf_len_, pos));
+  pos = 0;
+  // the observer of old version never compresses the log buffer
+  ASSERT_EQ(OB_SUCCESS, recv_resp->deserialize(buf_, size, pos));
+  EXPECT_EQ(size, pos);
+  EXPECT_FALSE(recv_resp->is_compressed());
+  EXPECT_EQ(LOG_SIZE, recv_resp->raw_size_);
+  ASSERT_EQ(OB_SUCCESS, result->assign(*recv_resp));
+  EXPECT_EQ(ObLSID(1001), result->get_ls_id());
+  EXPECT_EQ(LSN(LOG_SIZE), result->get_next_req_lsn());
+  ASSERT_EQ(LOG_SIZE, result->get_pos());
+  EXPECT_EQ(0, MEMCMP(log_data_, result->get_log_entry_buf(), LOG_SIZE));
+
+  // and it ignores the compressor asked by the new CDC Connector
+  ObCdcLSFetchLogReq req;
+  req.reset(ObLSID(1001), LSN(0), 1000);
+  req.set_compressor_type(LZ4_COMPRESSOR);
+  OldFetchLogReq old_req;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, req.serialize(buf_, buf_len_, pos));
+  const int64_t req_size = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, old_req.deserialize(buf_, req_size, pos));
+  EXPECT_EQ(req_size, pos);
+  EXPECT_EQ(ObLSID(1001), old_req.ls_id_);
+  EXPECT_EQ(1000, old_req.upper_limit_ts_);
+  delete old_resp;
+  delete recv_resp;
+  delete result;
+}
+
+TEST_F(TestCdcReq, compatible_with_old_cdc_connector)
+{
+  // the CDC Connector of old version doesn't ask for compression
+  OldFetchLogReq old_req;
+  old_req.ls_id_ = ObLSID(1001);
+  old_req.start_lsn_ = LSN(0);
+  old_req.upper_limit_ts_ = 1000;
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, old_req.serialize(buf_, buf_len_, pos));
+  const int64_t req_size = pos;
+  ObCdcLSFetchLogReq req;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, req.deserialize(buf_, req_size, pos));
+  EXPECT_EQ(req_size, pos);
+  EXPECT_TRUE(req.is_valid());
+  EXPECT_EQ(NONE_COMPRESSOR, req.get_compressor_type());
+
+  // so the response is not compressed, and it skips the new fields at the tail
+  ObCdcLSFetchLogResp *resp = new ObCdcLSFetchLogResp();
+  OldFetchLogResp *old_resp = new OldFetchLogResp();
+  fill_resp(log_data_, LOG_SIZE, *resp);
+  ASSERT_EQ(OB_SUCCESS, resp->compress(req.get_compressor_type()));
+  EXPECT_FALSE(resp->is_compressed());
+  pos = 0;
+  const int64_t size = resp->get_serialize_size();
+  ASSERT_EQ(OB_SUCCESS, resp->serialize(buf_, buf_len_, pos));
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, old_resp->deserialize(buf_, size, pos));
+  EXPECT_EQ(size, pos);
+  EXPECT_EQ(1, old_resp->log_num_);
+  ASSERT_EQ(LOG_SIZE, old_resp->pos_);
+  EXPECT_EQ(0, MEMCMP(log_data_, old_resp->log_entry_buf_, LOG_SIZE));
+  delete resp;
+  delete old_resp;
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_cdc_req.log");
+  OB_LOGGER.set_file_name("test_cdc_req.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/oblog/ob_log.h"
+#include "share/ob_errno.h"
+#include "logservice/palf/log_rpc.h"
+#include "logservice/palf/log_rpc_packet.h"
+#include "logservice/palf/log_req.h"
+#include "logservice/palf/log_writer_utils.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace palf;
+namespace unittest
+{
+class TestLogBatchRpc : public ::testing::Test
+{
+public:
+  TestLogBatchRpc() : src_(ObAddr::IPV4, "127.0.0.1", 2882) {}
+  // encode the packet as the batch packet does, and decode it from a copy of the
+  // encoded data as LogBatchReqThreadPool does
+  template <typename ReqType>
+  int round_trip(const LogRpcPacketImpl<ReqType> &packet,
+                 char *buf,
+                 const int64_t buf_len,
+                 LogRpcPacketImpl<ReqType> &decoded)
+  {
+    int ret = OB_SUCCESS;
+    LogBatchPacketFiller<ReqType> filler(packet);
+    int64_t filled_size = 0;
+    int64_t pos = 0;
+    if (filler.get_req_size() > buf_len) {
+      ret = OB_BUF_NOT_ENOUGH;
+    } else if (OB_FAIL(filler.fill_buffer(buf, filler.get_req_size(), filled_size))) {
+      PALF_LOG(WARN, "fill_buffer failed", K(ret));
+    } else if (filled_size != filler.get_req_size()
+        || filler.get_estimate_size() < filled_size) {
+      ret = OB_ERR_UNEXPECTED;
+      PALF_LOG(WARN, "unexpected filled size", K(ret), K(filled_size), K(filler.get_req_size()));
+    } else if (OB_FAIL(decoded.deserialize(buf, filled_size, pos))) {
+      PALF_LOG(WARN, "deserialize failed", K(ret));
+    } else if (pos != filled_size) {
+      ret = OB_ERR_UNEXPECTED;
+      PALF_LOG(WARN, "unexpected deserialize size", K(ret), K(pos), K(filled_size));
+    }
+    return ret;
+  }
+protected:
+  ObAddr src_;
+};
+
+TEST_F(TestLogBatchRpc, push_req_round_trip)
+{
+  const int64_t palf_id = 1001;
+  char data[1024];
+  for (int64_t i = 0; i < 1024; i++) {
+    data[i] = static_cast<char>(i);
+  }
+  LogWriteBuf write_buf;
+  ASSERT_EQ(OB_SUCCESS, write_buf.push_back(data, 512));
+  ASSERT_EQ(OB_SUCCESS, write_buf.push_back(data + 512, 512));
+  LogPushReq req(PUSH_LOG, 3, 2, LSN(4096), LSN(8192), write_buf);
+  LogRpcPacketImpl<LogPushReq> packet(src_, palf_id, req);
+
+  char buf[4096];
+  LogRpcPacketImpl<LogPushReq> decoded;
+  ASSERT_EQ(OB_SUCCESS, round_trip(packet, buf, sizeof(buf), decoded));
+  EXPECT_EQ(src_, decoded.src_);
+  EXPECT_EQ(palf_id, decoded.palf_id_);
+  EXPECT_EQ(req.push_log_type_, decoded.req_.push_log_type_);
+  EXPECT_EQ(req.msg_proposal_id_, decoded.req_.msg_proposal_id_);
+  EXPECT_EQ(req.prev_log_proposal_id_, decoded.req_.prev_log_proposal_id_);
+  EXPECT_EQ(req.prev_lsn_, decoded.req_.prev_lsn_);
+  EXPECT_EQ(req.curr_lsn_, decoded.req_.curr_lsn_);
+  // the log data is decoded as one continuous buffer
+  ASSERT_EQ(write_buf.get_total_size(), decoded.req_.write_buf_.get_total_size());
+  char decoded_data[1024];
+  ASSERT_TRUE(decoded.req_.write_buf_.check_memory_is_continous());
+  decoded.req_.write_buf_.memcpy_to_continous_memory(decoded_data);
+  EXPECT_EQ(0, MEMCMP(data, decoded_data, sizeof(data)));
+}
+
+TEST_F(TestLogBatchRpc, push_resp_round_trip)
+{
+  const int64_t palf_id = 1002;
+  LogPushResp resp(5, LSN(1024));
+  LogRpcPacketImpl<LogPushResp> packet(src_, palf_id, resp);
+
+  char buf[1024];
+  LogRpcPacketImpl<LogPushResp> decoded;
+  ASSERT_EQ(OB_SUCCESS, round_trip(packet, buf, sizeof(buf), decoded));
+  EXPECT_EQ(src_, decoded.src_);
+  EXPECT_EQ(palf_id, decoded.palf_id_);
+  EXPECT_EQ(resp.msg_proposal_id_, decoded.req_.msg_proposal_id_);
+  EXPECT_EQ(resp.lsn_, decoded.req_.lsn_);
+}
+
+TEST_F(TestLogBatchRpc, truncated_packet)
+{
+  LogPushResp resp(5, LSN(1024));
+  LogRpcPacketImpl<LogPushResp> packet(src_, 1003, resp);
+  LogBatchPacketFiller<LogPushResp> filler(packet);
+  char buf[1024];
+  int64_t filled_size = 0;
+  // the buffer reserved by ObBatchRpc is not enough
+  EXPECT_NE(OB_SUCCESS, filler.fill_buffer(buf, filler.get_req_size() - 1, filled_size));
+  ASSERT_EQ(OB_SUCCESS, filler.fill_buffer(buf, sizeof(buf), filled_size));
+  // a sub request cut off in the batch packet is not decoded
+  LogRpcPacketImpl<LogPushResp> decoded;
+  int64_t pos = 0;
+  EXPECT_NE(OB_SUCCESS, decoded.deserialize(buf, filled_size - 1, pos));
+  EXPECT_EQ(0, pos);
+}
+
+TEST_F(TestLogBatchRpc, truncated_log_data)
+{
+  char data[1024];
+  MEMSET(data, 'a', sizeof(data));
+  LogWriteBuf write_buf;
+  ASSERT_EQ(OB_SUCCESS, write_buf.push_back(data, sizeof(data)));
+  LogPushReq req(PUSH_LOG, 3, 2, LSN(4096), LSN(8192), write_buf);
+  LogRpcPacketImpl<LogPushReq> packet(src_, 1004, req);
+  LogBatchPacketFiller<LogPushReq> filler(packet);
+  char buf[4096];
+  int64_t filled_size = 0;
+  // the log data is not copied out of the buffer
+  EXPECT_NE(OB_SUCCESS, filler.fill_buffer(buf, filler.get_req_size() - 1, filled_size));
+  ASSERT_EQ(OB_SUCCESS, filler.fill_buffer(buf, sizeof(buf), filled_size));
+  // and not referred to out of the packet
+  LogRpcPacketImpl<LogPushReq> decoded;
+  int64_t pos = 0;
+  EXPECT_NE(OB_SUCCESS, decoded.deserialize(buf, filled_size - 1, pos));
+  EXPECT_EQ(0, pos);
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_log_batch_rpc.log");
+  OB_LOGGER.set_file_name("test_log_batch_rpc.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_batch_rpc");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
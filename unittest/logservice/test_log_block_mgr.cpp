@@ -0,0 +1,220 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <thread>
+#include "lib/file/file_directory_utils.h"
+#include "lib/oblog/ob_log.h"
+#include "logservice/palf/log_block_pool_interface.h"
+#include "logservice/palf/log_define.h"
+#include "share/ob_errno.h"
+
+#define private public
+#include "logservice/palf/log_block_mgr.h"
+#undef private
+
+namespace oceanbase
+{
+using namespace common;
+using namespace palf;
+namespace unittest
+{
+// creates blocks with ftruncate instead of moving them from the server log block pool
+class MockLogBlockPool : public ILogBlockPool
+{
+public:
+  MockLogBlockPool() : create_cnt_(0), remove_cnt_(0) {}
+  int create_block_at(const palf::FileDesc &dir_fd,
+                      const char *block_path,
+                      const int64_t block_size) override
+  {
+    int ret = OB_SUCCESS;
+    int fd = -1;
+    if (-1 == (fd = ::openat(dir_fd, block_path, O_RDWR | O_CREAT | O_EXCL, 0644))) {
+      ret = convert_sys_errno();
+      PALF_LOG(WARN, "openat failed", K(ret), K(block_path));
+    } else if (-1 == ::ftruncate(fd, block_size)) {
+      ret = convert_sys_errno();
+      PALF_LOG(WARN, "ftruncate failed", K(ret), K(block_path));
+    } else {
+      ATOMIC_INC(&create_cnt_);
+    }
+    if (-1 != fd) {
+      ::close(fd);
+    }
+    return ret;
+  }
+  int remove_block_at(const palf::FileDesc &dir_fd,
+                      const char *block_path) override
+  {
+    int ret = OB_SUCCESS;
+    if (-1 == ::unlinkat(dir_fd, block_path, 0)) {
+      ret = convert_sys_errno();
+      PALF_LOG(WARN, "unlinkat failed", K(ret), K(block_path));
+    } else {
+      ATOMIC_INC(&remove_cnt_);
+    }
+    return ret;
+  }
+  int64_t create_cnt_;
+  int64_t remove_cnt_;
+};
+
+class TestLogBlockMgr : public ::testing::Test
+{
+public:
+  static constexpr const char *LOG_DIR = "test_log_block_mgr_dir";
+  virtual void SetUp() override
+  {
+    system("rm -rf test_log_block_mgr_dir");
+    system("mkdir test_log_block_mgr_dir");
+  }
+  virtual void TearDown() override
+  {
+    system("rm -rf test_log_block_mgr_dir");
+  }
+  static bool block_exist(const char *name)
+  {
+    char path[OB_MAX_FILE_NAME_LENGTH] = {'\0'};
+    snprintf(path, sizeof(path), "%s/%s", LOG_DIR, name);
+    return 0 == ::access(path, F_OK);
+  }
+  static bool block_exist(const block_id_t block_id)
+  {
+    char name[OB_MAX_FILE_NAME_LENGTH] = {'\0'};
+    snprintf(name, sizeof(name), "%lu", block_id);
+    return block_exist(name);
+  }
+protected:
+  MockLogBlockPool pool_;
+};
+
+TEST_F(TestLogBlockMgr, prepare_and_switch)
+{
+  LogBlockMgr mgr;
+  ASSERT_EQ(OB_SUCCESS, mgr.init(LOG_DIR, 0, PALF_BLOCK_SIZE, &pool_));
+  ASSERT_FALSE(mgr.has_prepared_block());
+
+  // no prepared block, created synchronously
+  ASSERT_EQ(OB_SUCCESS, mgr.switch_next_block(0));
+  ASSERT_EQ(0, mgr.prepared_switch_cnt_);
+  ASSERT_EQ(1, mgr.stall_switch_cnt_);
+  ASSERT_TRUE(block_exist(block_id_t(0)));
+
+  ASSERT_EQ(OB_SUCCESS, mgr.prepare_next_block());
+  ASSERT_TRUE(mgr.has_prepared_block());
+  ASSERT_TRUE(block_exist(LogBlockMgr::PREPARED_BLOCK_NAME));
+  // prepared only once
+  ASSERT_EQ(OB_SUCCESS, mgr.prepare_next_block());
+  ASSERT_EQ(2, pool_.create_cnt_);
+
+  // the prepared block is renamed to the next block
+  ASSERT_EQ(OB_SUCCESS, mgr.switch_next_block(1));
+  ASSERT_FALSE(mgr.has_prepared_block());
+  ASSERT_FALSE(block_exist(LogBlockMgr::PREPARED_BLOCK_NAME));
+  ASSERT_TRUE(block_exist(block_id_t(1)));
+  ASSERT_EQ(1, mgr.prepared_switch_cnt_);
+  ASSERT_EQ(1, mgr.stall_switch_cnt_);
+  ASSERT_EQ(2, pool_.create_cnt_);
+
+  // consumed, the next switch stalls again
+  ASSERT_EQ(OB_SUCCESS, mgr.switch_next_block(2));
+  ASSERT_EQ(1, mgr.prepared_switch_cnt_);
+  ASSERT_EQ(2, mgr.stall_switch_cnt_);
+
+  block_id_t min_block_id = LOG_INVALID_BLOCK_ID;
+  block_id_t max_block_id = LOG_INVALID_BLOCK_ID;
+  ASSERT_EQ(OB_SUCCESS, mgr.get_block_id_range(min_block_id, max_block_id));
+  ASSERT_EQ(0, min_block_id);
+  ASSERT_EQ(2, max_block_id);
+  mgr.destroy();
+}
+
+TEST_F(TestLogBlockMgr, prepare_concurrent_with_switch)
+{
+  const block_id_t BLOCK_CNT = 50;
+  LogBlockMgr mgr;
+  bool stop = false;
+  int prepare_ret = OB_SUCCESS;
+  ASSERT_EQ(OB_SUCCESS, mgr.init(LOG_DIR, 0, PALF_BLOCK_SIZE, &pool_));
+  std::thread preparer([&]() {
+    while (!ATOMIC_LOAD(&stop) && OB_SUCCESS == prepare_ret) {
+      prepare_ret = mgr.prepare_next_block();
+    }
+  });
+  int switch_ret = OB_SUCCESS;
+  for (block_id_t block_id = 0; block_id < BLOCK_CNT && OB_SUCCESS == switch_ret; block_id++) {
+    switch_ret = mgr.switch_next_block(block_id);
+    ::usleep(1000);
+  }
+  ATOMIC_STORE(&stop, true);
+  preparer.join();
+  ASSERT_EQ(OB_SUCCESS, switch_ret);
+  ASSERT_EQ(OB_SUCCESS, prepare_ret);
+  // every switch either used the prepared block or created one, and a block is never lost
+  ASSERT_TRUE(BLOCK_CNT == mgr.prepared_switch_cnt_ + mgr.stall_switch_cnt_);
+  ASSERT_LT(0, mgr.prepared_switch_cnt_);
+  for (block_id_t block_id = 0; block_id < BLOCK_CNT; block_id++) {
+    ASSERT_TRUE(block_exist(block_id));
+  }
+  ASSERT_FALSE(block_exist(BLOCK_CNT));
+  const int64_t prepared_cnt = mgr.has_prepared_block() ? 1 : 0;
+  ASSERT_EQ(prepared_cnt, block_exist(LogBlockMgr::PREPARED_BLOCK_NAME) ? 1 : 0);
+  ASSERT_TRUE(BLOCK_CNT + prepared_cnt == pool_.create_cnt_);
+  mgr.destroy();
+}
+
+TEST_F(TestLogBlockMgr, reopen_with_prepared_block)
+{
+  {
+    LogBlockMgr mgr;
+    ASSERT_EQ(OB_SUCCESS, mgr.init(LOG_DIR, 0, PALF_BLOCK_SIZE, &pool_));
+    ASSERT_EQ(OB_SUCCESS, mgr.switch_next_block(0));
+    ASSERT_EQ(OB_SUCCESS, mgr.prepare_next_block());
+    mgr.destroy();
+  }
+  ASSERT_TRUE(block_exist(LogBlockMgr::PREPARED_BLOCK_NAME));
+
+  LogBlockMgr mgr;
+  ASSERT_EQ(OB_SUCCESS, mgr.init(LOG_DIR, 0, PALF_BLOCK_SIZE, &pool_));
+  // the prepared block left by the previous LogBlockMgr is not a log block
+  block_id_t min_block_id = LOG_INVALID_BLOCK_ID;
+  block_id_t max_block_id = LOG_INVALID_BLOCK_ID;
+  ASSERT_EQ(OB_SUCCESS, mgr.get_block_id_range(min_block_id, max_block_id));
+  ASSERT_EQ(0, min_block_id);
+  ASSERT_EQ(0, max_block_id);
+  ASSERT_TRUE(mgr.has_prepared_block());
+
+  // and it is used by the next switch
+  ASSERT_EQ(OB_SUCCESS, mgr.switch_next_block(1));
+  ASSERT_EQ(1, mgr.prepared_switch_cnt_);
+  ASSERT_EQ(0, mgr.stall_switch_cnt_);
+  ASSERT_FALSE(block_exist(LogBlockMgr::PREPARED_BLOCK_NAME));
+  ASSERT_TRUE(block_exist(block_id_t(1)));
+  ASSERT_TRUE(2 == pool_.create_cnt_);
+  mgr.destroy();
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_log_block_mgr.log");
+  OB_LOGGER.set_file_name("test_log_block_mgr.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_block_mgr");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
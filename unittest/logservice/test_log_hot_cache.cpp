@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "logservice/palf/log_hot_cache.h"
+#include "logservice/palf/log_writer_utils.h"
+#undef private
+#include "share/rc/ob_tenant_base.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace palf;
+
+namespace unittest
+{
+
+class TestLogHotCache : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    // init MTL
+    ObTenantBase tbase(1001);
+    ObTenantEnv::set_tenant(&tbase);
+  }
+  virtual void TearDown()
+  {
+    hot_cache_.destroy();
+  }
+protected:
+  LogHotCache hot_cache_;
+};
+
+TEST_F(TestLogHotCache, test_fill_and_read)
+{
+  char data[1024];
+  char read_buf[1024];
+  for (int64_t i = 0; i < sizeof(data); i++) {
+    data[i] = static_cast<char>(i % 128);
+  }
+  LogWriteBuf write_buf;
+  EXPECT_EQ(OB_SUCCESS, write_buf.push_back(data, 512));
+  EXPECT_EQ(OB_SUCCESS, write_buf.push_back(data + 512, 512));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, hot_cache_.read(LSN(100), 10, read_buf));
+  hot_cache_.fill(LSN(100), write_buf);
+  EXPECT_EQ(OB_SUCCESS, hot_cache_.read(LSN(100), 1024, read_buf));
+  EXPECT_EQ(0, MEMCMP(data, read_buf, 1024));
+  EXPECT_EQ(OB_SUCCESS, hot_cache_.read(LSN(600), 24, read_buf));
+  EXPECT_EQ(0, MEMCMP(data + 500, read_buf, 24));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, hot_cache_.read(LSN(99), 10, read_buf));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, hot_cache_.read(LSN(1100), 100, read_buf));
+
+  // not continuous, restart from the new lsn
+  hot_cache_.fill(LSN(4096), write_buf);
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, hot_cache_.read(LSN(100), 10, read_buf));
+  EXPECT_EQ(OB_SUCCESS, hot_cache_.read(LSN(4096), 1024, read_buf));
+  EXPECT_EQ(0, MEMCMP(data, read_buf, 1024));
+}
+
+TEST_F(TestLogHotCache, test_wrap_around)
+{
+  const int64_t buf_len = 1024 * 1024;
+  char *data = static_cast<char *>(ob_malloc(buf_len, "TestHotCache"));
+  char *read_buf = static_cast<char *>(ob_malloc(buf_len, "TestHotCache"));
+  ASSERT_NE(nullptr, data);
+  ASSERT_NE(nullptr, read_buf);
+  LSN lsn(0);
+  // fill 5MB, the first 1MB has been overwritten
+  for (int64_t i = 0; i < 5; i++) {
+    MEMSET(data, static_cast<char>(i), buf_len);
+    LogWriteBuf write_buf;
+    EXPECT_EQ(OB_SUCCESS, write_buf.push_back(data, buf_len));
+    hot_cache_.fill(lsn, write_buf);
+    lsn = lsn + buf_len;
+  }
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, hot_cache_.read(LSN(0), 100, read_buf));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, hot_cache_.read(LSN(buf_len - 100), 200, read_buf));
+  EXPECT_EQ(OB_SUCCESS, hot_cache_.read(LSN(4 * buf_len), buf_len, read_buf));
+  EXPECT_EQ(4, read_buf[0]);
+  EXPECT_EQ(4, read_buf[buf_len - 1]);
+  // across the tail of ring buffer
+  EXPECT_EQ(OB_SUCCESS, hot_cache_.read(LSN(4 * buf_len - 100), 200, read_buf));
+  EXPECT_EQ(3, read_buf[0]);
+  EXPECT_EQ(4, read_buf[199]);
+  ob_free(data);
+  ob_free(read_buf);
+}
+
+TEST_F(TestLogHotCache, test_truncate_and_reset)
+{
+  char data[1024];
+  char read_buf[1024];
+  MEMSET(data, 'a', sizeof(data));
+  LogWriteBuf write_buf;
+  EXPECT_EQ(OB_SUCCESS, write_buf.push_back(data, sizeof(data)));
+  hot_cache_.fill(LSN(0), write_buf);
+  hot_cache_.truncate(LSN(512));
+  EXPECT_EQ(OB_SUCCESS, hot_cache_.read(LSN(0), 512, read_buf));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, hot_cache_.read(LSN(0), 513, read_buf));
+  // rewrite after truncate
+  MEMSET(data, 'b', sizeof(data));
+  hot_cache_.fill(LSN(512), write_buf);
+  EXPECT_EQ(OB_SUCCESS, hot_cache_.read(LSN(500), 24, read_buf));
+  EXPECT_EQ('a', read_buf[0]);
+  EXPECT_EQ('b', read_buf[23]);
+  hot_cache_.reset(LSN(8192));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, hot_cache_.read(LSN(500), 24, read_buf));
+  EXPECT_EQ(0, hot_cache_.seq_ & 1);
+}
+
+} // END of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf ./test_log_hot_cache.log*");
+  OB_LOGGER.set_file_name("test_log_hot_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_hot_cache");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
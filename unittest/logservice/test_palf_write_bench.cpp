@@ -0,0 +1,465 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+// Write path benchmark of palf, it doesn't need an observer:
+//
+//   ./palf_write_bench -e 1 -l 1 -t 64 -s 512 -d 10
+//
+//   -e  count of PalfEnv in this process, each one has its own log dir and LogIOWorker
+//   -l  count of log streams in each PalfEnv
+//   -t  count of append threads, thread i appends to log stream (i % (e * l))
+//   -s  size of each log
+//   -d  duration in seconds
+//
+// Each append thread submits one log and waits until palf reports it's committed by
+// PalfFSCb, so the thread count is the concurrency. The throughput of every second and
+// the percentiles of the commit latency and of its stages are printed to stdout:
+//   append        PalfHandle::append(), the log is copied into the group buffer
+//   wait commit   group buffer + LogIOWorker + fsync + ack, until PalfFSCb is called
+//   wake up       from PalfFSCb to the append thread being waked up
+// The finer costs inside palf are printed by palf itself into palf_write_bench.log:
+//   [PALF STAT GROUP LOG INFO]    group buffer, logs and bytes of each group log
+//   [PALF STAT LOG SUBMIT WAIT]   group buffer, wait for the group log to be frozen
+//   [PALF STAT LOG SLIDE WAIT]    LogIOWorker + fsync + ack of the majority
+//   [PALF STAT FS CB]             cost of PalfFSCb
+//   inner_write_once_ success     pwrite count and cost of LogBlockHandler
+
+#include <fcntl.h>
+#include <getopt.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include "lib/file/file_directory_utils.h"
+#include "lib/lock/ob_thread_cond.h"
+#include "lib/ob_define.h"
+#include "lib/time/ob_time_utility.h"
+#include "logservice/palf/log_block_pool_interface.h"
+#include "logservice/palf/log_define.h"
+#include "logservice/palf/palf_callback.h"
+#include "logservice/palf/palf_env.h"
+#include "logservice/palf/palf_handle.h"
+#include "logservice/palf/palf_options.h"
+#include "rpc/frame/ob_req_transport.h"
+#include "share/allocator/ob_tenant_mutil_allocator.h"
+#include "share/rc/ob_tenant_base.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace palf;
+using namespace share;
+
+int64_t env_num = 1;
+int64_t ls_num = 1;
+int64_t thread_num = 64;
+int64_t nbytes = 512;
+int64_t duration_s = 10;
+
+class DummyBlockPool : public palf::ILogBlockPool {
+public:
+  virtual int create_block_at(const palf::FileDesc &dir_fd,
+                              const char *block_path,
+                              const int64_t block_size)
+  {
+    UNUSED(block_size);
+    int fd = -1;
+    if (-1 == (fd = ::openat(dir_fd, block_path, palf::LOG_WRITE_FLAG | O_CREAT, palf::FILE_OPEN_MODE))) {
+      return OB_IO_ERROR;
+    } else if (-1 == ::fallocate(fd, 0, 0, PALF_PHY_BLOCK_SIZE)) {
+      ::close(fd);
+      return OB_IO_ERROR;
+    }
+    ::close(fd);
+    return OB_SUCCESS;
+  }
+  virtual int remove_block_at(const palf::FileDesc &dir_fd,
+                              const char *block_path)
+  {
+    if (-1 == ::unlinkat(dir_fd, block_path, 0)) {
+      return OB_IO_ERROR;
+    }
+    return OB_SUCCESS;
+  }
+};
+
+// log-linear buckets of latency in us, 1us precision below 1ms, 10us below 10ms,
+// 100us below 100ms and 1ms below 1s
+class LatencyHistogram
+{
+public:
+  static const int64_t BUCKET_NUM = 1000 + 900 * 3 + 1;
+  LatencyHistogram() : count_(0), sum_(0), max_(0)
+  {
+    memset(buckets_, 0, sizeof(buckets_));
+  }
+  void add(const int64_t latency_us)
+  {
+    buckets_[to_bucket_(latency_us)]++;
+    count_++;
+    sum_ += latency_us;
+    max_ = MAX(max_, latency_us);
+  }
+  void merge(const LatencyHistogram &other)
+  {
+    for (int64_t i = 0; i < BUCKET_NUM; i++) {
+      buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    sum_ += other.sum_;
+    max_ = MAX(max_, other.max_);
+  }
+  int64_t percentile(const double p) const
+  {
+    const int64_t target = static_cast<int64_t>(static_cast<double>(count_) * p);
+    int64_t accum = 0;
+    int64_t i = 0;
+    for (; count_ > 0 && i < BUCKET_NUM - 1; i++) {
+      accum += buckets_[i];
+      if (accum > target) {
+        break;
+      }
+    }
+    return from_bucket_(i);
+  }
+  int64_t get_count() const { return count_; }
+  int64_t get_avg() const { return 0 == count_ ? 0 : sum_ / count_; }
+  int64_t get_max() const { return max_; }
+private:
+  static int64_t to_bucket_(const int64_t us)
+  {
+    int64_t idx = 0;
+    if (us < 1000) {
+      idx = MAX(us, 0);
+    } else if (us < 10 * 1000) {
+      idx = 1000 + (us - 1000) / 10;
+    } else if (us < 100 * 1000) {
+      idx = 1900 + (us - 10 * 1000) / 100;
+    } else if (us < 1000 * 1000) {
+      idx = 2800 + (us - 100 * 1000) / 1000;
+    } else {
+      idx = BUCKET_NUM - 1;
+    }
+    return idx;
+  }
+  static int64_t from_bucket_(const int64_t idx)
+  {
+    int64_t us = 0;
+    if (idx < 1000) {
+      us = idx;
+    } else if (idx < 1900) {
+      us = 1000 + (idx - 1000) * 10;
+    } else if (idx < 2800) {
+      us = 10 * 1000 + (idx - 1900) * 100;
+    } else {
+      us = 100 * 1000 + (idx - 2800) * 1000;
+    }
+    return us;
+  }
+private:
+  int64_t buckets_[BUCKET_NUM];
+  int64_t count_;
+  int64_t sum_;
+  int64_t max_;
+};
+
+// a log stream under benchmark, the append threads wait on it for the committed end_lsn
+class BenchLogStream : public PalfFSCb
+{
+public:
+  BenchLogStream() : handle_(), cond_(), end_lsn_(PALF_INITIAL_LSN_VAL), update_ts_(0) {}
+  int init()
+  {
+    return cond_.init(ObWaitEventIds::DEFAULT_COND_WAIT);
+  }
+  int update_end_lsn(int64_t id, const LSN &end_lsn, const int64_t proposal_id) override final
+  {
+    UNUSED(id);
+    UNUSED(proposal_id);
+    cond_.lock();
+    if (end_lsn > end_lsn_) {
+      end_lsn_ = end_lsn;
+      update_ts_ = ObTimeUtility::current_time();
+    }
+    cond_.broadcast();
+    cond_.unlock();
+    return OB_SUCCESS;
+  }
+  // returns the time of the last update of end_lsn, which committed the log of lsn
+  int64_t wait_committed(const LSN &lsn)
+  {
+    int64_t update_ts = 0;
+    cond_.lock();
+    while (end_lsn_ <= lsn) {
+      cond_.wait_us(1000);
+    }
+    update_ts = update_ts_;
+    cond_.unlock();
+    return update_ts;
+  }
+public:
+  PalfHandle handle_;
+private:
+  ObThreadCond cond_;
+  LSN end_lsn_;
+  int64_t update_ts_;
+};
+
+struct BenchThreadStat
+{
+  BenchThreadStat()
+    : latency_(), append_latency_(), wait_commit_latency_(), wakeup_latency_(), append_fail_cnt_(0) {}
+  void merge(const BenchThreadStat &other)
+  {
+    latency_.merge(other.latency_);
+    append_latency_.merge(other.append_latency_);
+    wait_commit_latency_.merge(other.wait_commit_latency_);
+    wakeup_latency_.merge(other.wakeup_latency_);
+    append_fail_cnt_ += other.append_fail_cnt_;
+  }
+  LatencyHistogram latency_;
+  LatencyHistogram append_latency_;
+  LatencyHistogram wait_commit_latency_;
+  LatencyHistogram wakeup_latency_;
+  int64_t append_fail_cnt_;
+};
+
+static void print_latency(const char *name, const LatencyHistogram &latency)
+{
+  fprintf(stdout, "%-16s avg=%ld p50=%ld p90=%ld p99=%ld p999=%ld max=%ld\n", name,
+      latency.get_avg(), latency.percentile(0.5), latency.percentile(0.9),
+      latency.percentile(0.99), latency.percentile(0.999), latency.get_max());
+}
+
+class TestPalfWriteBench : public ::testing::Test
+{
+public:
+  TestPalfWriteBench()
+    : tenant_base_(OB_SERVER_TENANT_ID),
+      allocator_(OB_SERVER_TENANT_ID),
+      transport_(NULL, NULL),
+      block_pool_(),
+      palf_envs_(),
+      log_streams_(),
+      is_running_(false),
+      total_cnt_(0)
+  {
+  }
+public:
+  void SetUp()
+  {
+    ObTenantEnv::set_tenant(&tenant_base_);
+    PalfDiskOptions options;
+    options.log_disk_usage_limit_size_ = 500 * 1024 * 1024 * 1024LL;
+    options.log_disk_utilization_threshold_ = 80;
+    options.log_disk_utilization_limit_threshold_ = 95;
+    palf_envs_.resize(env_num, NULL);
+    log_streams_.resize(env_num * ls_num, NULL);
+    for (int64_t i = 0; i < env_num; i++) {
+      char log_dir[OB_MAX_FILE_NAME_LENGTH];
+      snprintf(log_dir, OB_MAX_FILE_NAME_LENGTH, "./palf_write_bench_%ld", i);
+      FileDirectoryUtils::delete_directory_rec(log_dir);
+      FileDirectoryUtils::create_directory(log_dir);
+      // every PalfEnv behaves as a single server
+      const ObAddr self(ObAddr::VER::IPV4, "127.0.0.1", static_cast<int32_t>(2021 + i));
+      ObMemberList member_list;
+      ASSERT_EQ(OB_SUCCESS, member_list.add_server(self));
+      ASSERT_EQ(OB_SUCCESS, PalfEnv::create_palf_env(options, log_dir, self, &transport_,
+          &allocator_, &block_pool_, palf_envs_[i]));
+      for (int64_t j = 0; j < ls_num; j++) {
+        BenchLogStream *ls = new BenchLogStream();
+        log_streams_[i * ls_num + j] = ls;
+        ASSERT_EQ(OB_SUCCESS, ls->init());
+        ASSERT_EQ(OB_SUCCESS, palf_envs_[i]->create(j + 1, AccessMode::APPEND, ls->handle_));
+        ASSERT_EQ(OB_SUCCESS, ls->handle_.register_file_size_cb(ls));
+        ASSERT_EQ(OB_SUCCESS, ls->handle_.set_initial_member_list(member_list, 1));
+      }
+    }
+    for (int64_t i = 0; i < env_num * ls_num; i++) {
+      wait_leader_(log_streams_[i]->handle_);
+    }
+  }
+
+  void TearDown()
+  {
+    for (int64_t i = 0; i < env_num; i++) {
+      for (int64_t j = 0; j < ls_num; j++) {
+        BenchLogStream *ls = log_streams_[i * ls_num + j];
+        if (NULL != ls) {
+          ls->handle_.unregister_file_size_cb();
+          palf_envs_[i]->close(ls->handle_);
+          delete ls;
+        }
+      }
+      PalfEnv::destroy_palf_env(palf_envs_[i]);
+    }
+    palf_envs_.clear();
+    log_streams_.clear();
+  }
+
+  void do_append(BenchLogStream &ls, BenchThreadStat &stat)
+  {
+    ObTenantEnv::set_tenant(&tenant_base_);
+    PalfAppendOptions options;
+    options.need_nonblock = false;
+    options.need_check_proposal_id = false;
+    char *buffer = new char[nbytes];
+    memset(buffer, 'a', nbytes);
+    while (ATOMIC_LOAD(&is_running_)) {
+      LSN lsn;
+      int64_t ts_ns = 0;
+      const int64_t begin_ts = ObTimeUtility::current_time();
+      if (OB_SUCCESS != ls.handle_.append(options, buffer, nbytes, 0, lsn, ts_ns)) {
+        stat.append_fail_cnt_++;
+        ob_usleep(1000);
+      } else {
+        const int64_t append_end_ts = ObTimeUtility::current_time();
+        // the log may be committed by PalfFSCb before append() returns
+        const int64_t commit_ts = MAX(ls.wait_committed(lsn), append_end_ts);
+        const int64_t end_ts = ObTimeUtility::current_time();
+        stat.append_latency_.add(append_end_ts - begin_ts);
+        stat.wait_commit_latency_.add(commit_ts - append_end_ts);
+        stat.wakeup_latency_.add(end_ts - commit_ts);
+        stat.latency_.add(end_ts - begin_ts);
+        ATOMIC_INC(&total_cnt_);
+      }
+    }
+    delete [] buffer;
+  }
+
+private:
+  void wait_leader_(PalfHandle &handle)
+  {
+    while (true) {
+      ObRole role;
+      int64_t proposal_id = 0;
+      bool is_pending_state = false;
+      handle.get_role(role, proposal_id, is_pending_state);
+      if (LEADER == role && !is_pending_state) {
+        break;
+      } else {
+        ob_usleep(1000);
+      }
+    }
+  }
+
+public:
+  ObTenantBase tenant_base_;
+  ObTenantMutilAllocator allocator_;
+  rpc::frame::ObReqTransport transport_;
+  DummyBlockPool block_pool_;
+  std::vector<PalfEnv *> palf_envs_;
+  std::vector<BenchLogStream *> log_streams_;
+  bool is_running_;
+  int64_t total_cnt_;
+};
+
+struct BenchThreadArg
+{
+  TestPalfWriteBench *bench_;
+  BenchLogStream *ls_;
+  BenchThreadStat stat_;
+};
+
+static void *append_thr_fn(void *arg)
+{
+  BenchThreadArg *p = reinterpret_cast<BenchThreadArg *>(arg);
+  p->bench_->do_append(*p->ls_, p->stat_);
+  return (void *)0;
+}
+
+TEST_F(TestPalfWriteBench, append)
+{
+  std::vector<pthread_t> tids(thread_num);
+  std::vector<BenchThreadArg *> args(thread_num, NULL);
+
+  fprintf(stdout, "palf write bench: env_num=%ld ls_num=%ld thread_num=%ld nbytes=%ld duration=%lds\n",
+      env_num, ls_num, thread_num, nbytes, duration_s);
+  ATOMIC_STORE(&is_running_, true);
+  const int64_t begin_ts = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < thread_num; i++) {
+    args[i] = new BenchThreadArg();
+    args[i]->bench_ = this;
+    args[i]->ls_ = log_streams_[i % (env_num * ls_num)];
+    ASSERT_EQ(0, pthread_create(&tids[i], NULL, append_thr_fn, args[i]));
+  }
+  int64_t last_cnt = 0;
+  for (int64_t i = 0; i < duration_s; i++) {
+    ob_usleep(1000 * 1000);
+    const int64_t curr_cnt = ATOMIC_LOAD(&total_cnt_);
+    fprintf(stdout, "[%lds] tps=%ld throughput=%.2fMB/s\n", i + 1, curr_cnt - last_cnt,
+        static_cast<double>((curr_cnt - last_cnt) * nbytes) / 1024 / 1024);
+    last_cnt = curr_cnt;
+  }
+  ATOMIC_STORE(&is_running_, false);
+
+  BenchThreadStat stat;
+  for (int64_t i = 0; i < thread_num; i++) {
+    pthread_join(tids[i], NULL);
+    stat.merge(args[i]->stat_);
+    delete args[i];
+  }
+  const int64_t cost_ts = ObTimeUtility::current_time() - begin_ts;
+  const LatencyHistogram &latency = stat.latency_;
+  const int64_t total_cnt = latency.get_count();
+  fprintf(stdout, "total: logs=%ld tps=%ld throughput=%.2fMB/s append_fail=%ld\n", total_cnt,
+      total_cnt * 1000 * 1000 / cost_ts,
+      static_cast<double>(total_cnt * nbytes) * 1000 * 1000 / cost_ts / 1024 / 1024,
+      stat.append_fail_cnt_);
+  fprintf(stdout, "latency(us):\n");
+  print_latency("  commit", latency);
+  print_latency("    append", stat.append_latency_);
+  print_latency("    wait commit", stat.wait_commit_latency_);
+  print_latency("    wake up", stat.wakeup_latency_);
+  PALF_LOG(INFO, "palf write bench finished", K(env_num), K(ls_num), K(thread_num), K(nbytes),
+      K(total_cnt), K(cost_ts), "avg_latency", latency.get_avg(), "p99_latency", latency.percentile(0.99),
+      "avg_append", stat.append_latency_.get_avg(), "avg_wait_commit", stat.wait_commit_latency_.get_avg(),
+      "avg_wake_up", stat.wakeup_latency_.get_avg());
+  EXPECT_LT(0, total_cnt);
+}
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  int opt = 0;
+  while (-1 != (opt = getopt(argc, argv, "e:l:t:s:d:"))) {
+    switch (opt) {
+      case 'e':
+        oceanbase::unittest::env_num = strtol(optarg, NULL, 10);
+        break;
+      case 'l':
+        oceanbase::unittest::ls_num = strtol(optarg, NULL, 10);
+        break;
+      case 't':
+        oceanbase::unittest::thread_num = strtol(optarg, NULL, 10);
+        break;
+      case 's':
+        oceanbase::unittest::nbytes = strtol(optarg, NULL, 10);
+        break;
+      case 'd':
+        oceanbase::unittest::duration_s = strtol(optarg, NULL, 10);
+        break;
+      default:
+        break;
+    }
+  }
+
+  OB_LOGGER.set_file_name("palf_write_bench.log", true);
+  OB_LOGGER.set_log_level("WARN");
+  // keep the per-stage stat of palf
+  OB_LOGGER.set_mod_log_levels("ALL.*:WARN, PALF.*:INFO, LIB.*:INFO");
+
+  PALF_LOG(INFO, "palf write bench begin");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "lib/oblog/ob_log.h"
+#include "lib/alloc/alloc_func.h"
+#include "share/ob_errno.h"
+#define private public
+#include "logservice/restoreservice/ob_remote_fetch_log_worker.h"
+#include "logservice/restoreservice/ob_fetch_log_task.h"
+#undef private
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace logservice;
+namespace unittest
+{
+const uint64_t TENANT_ID = 1001;
+const int64_t LS_COUNT = 4;
+const int64_t THREAD_COUNT = 8;
+
+class TestRemoteFetchLogWorker : public ::testing::Test
+{
+public:
+  virtual void SetUp() override
+  {
+    worker_.tenant_id_ = TENANT_ID;
+    ASSERT_EQ(OB_SUCCESS, worker_.task_queue_.init(1024, "RFLTaskQueue", TENANT_ID));
+    ASSERT_EQ(OB_SUCCESS, worker_.in_flight_ls_.create(64, "RFLInFlight", "RFLInFlight", TENANT_ID));
+  }
+  virtual void TearDown() override
+  {
+    worker_.in_flight_ls_.destroy();
+  }
+protected:
+  ObRemoteFetchWorker worker_;
+};
+
+TEST_F(TestRemoteFetchLogWorker, one_task_per_ls_in_flight)
+{
+  int64_t in_flight[LS_COUNT] = {0};
+  int64_t max_in_flight[LS_COUNT] = {0};
+  int64_t handled[LS_COUNT] = {0};
+  int64_t mark_fail_count = 0;
+  std::vector<std::thread> threads;
+  // threads race to handle the tasks of a few log streams, as the fetch log threads do
+  for (int64_t i = 0; i < THREAD_COUNT; i++) {
+    threads.push_back(std::thread([&, i]() {
+      for (int64_t j = 0; j < 10000; j++) {
+        const int64_t idx = (i + j) % LS_COUNT;
+        const ObLSID id(1001 + idx);
+        bool marked = false;
+        if (OB_SUCCESS != worker_.mark_in_flight_(id, marked)) {
+          ATOMIC_INC(&mark_fail_count);
+        } else if (marked) {
+          const int64_t cnt = ATOMIC_AAF(&in_flight[idx], 1);
+          int64_t max_cnt = ATOMIC_LOAD(&max_in_flight[idx]);
+          while (cnt > max_cnt && ! ATOMIC_BCAS(&max_in_flight[idx], max_cnt, cnt)) {
+            max_cnt = ATOMIC_LOAD(&max_in_flight[idx]);
+          }
+          ATOMIC_INC(&handled[idx]);
+          ATOMIC_DEC(&in_flight[idx]);
+          worker_.unmark_in_flight_(id);
+        }
+      }
+    }));
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(0, mark_fail_count);
+  EXPECT_EQ(0, worker_.in_flight_ls_.size());
+  for (int64_t i = 0; i < LS_COUNT; i++) {
+    EXPECT_EQ(1, max_in_flight[i]) << "ls: " << i;
+    EXPECT_LT(0, handled[i]) << "ls: " << i;
+  }
+}
+
+TEST_F(TestRemoteFetchLogWorker, retry_task_of_ls_in_flight)
+{
+  const ObLSID id(1001);
+  ObFetchLogTask task(id, 1, palf::LSN(0), 1024, 1);
+  bool marked = false;
+  // another thread is handling the task of the log stream
+  ASSERT_EQ(OB_SUCCESS, worker_.mark_in_flight_(id, marked));
+  ASSERT_TRUE(marked);
+  ASSERT_EQ(OB_SUCCESS, worker_.task_queue_.push(&task));
+
+  bool need_wait = false;
+  worker_.do_thread_task_(need_wait);
+  // the task is not handled but pushed back
+  EXPECT_TRUE(need_wait);
+  EXPECT_EQ(palf::LSN(0), task.cur_lsn_);
+  EXPECT_EQ(1, worker_.task_queue_.size());
+  EXPECT_EQ(OB_HASH_EXIST, worker_.in_flight_ls_.exist_refactored(id));
+
+  void *data = NULL;
+  ASSERT_EQ(OB_SUCCESS, worker_.task_queue_.pop(data));
+  EXPECT_EQ(&task, data);
+  worker_.unmark_in_flight_(id);
+  EXPECT_EQ(OB_HASH_NOT_EXIST, worker_.in_flight_ls_.exist_refactored(id));
+}
+
+TEST_F(TestRemoteFetchLogWorker, thread_count_by_tenant_memory)
+{
+  // no tenant config in the unittest, log_restore_concurrency is taken as 0
+  lib::set_tenant_memory_limit(TENANT_ID, 1L << 30);
+  EXPECT_EQ(1, worker_.calc_thread_count_());
+  lib::set_tenant_memory_limit(TENANT_ID, 16L << 30);
+  EXPECT_EQ(6, worker_.calc_thread_count_());
+  lib::set_tenant_memory_limit(TENANT_ID, 1024L << 30);
+  EXPECT_EQ(ObRemoteFetchWorker::MAX_FETCH_LOG_THREAD_NUM + 0, worker_.calc_thread_count_());
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_remote_fetch_log_worker.log");
+  OB_LOGGER.set_file_name("test_remote_fetch_log_worker.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  CLOG_LOG(INFO, "begin unittest::test_remote_fetch_log_worker");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
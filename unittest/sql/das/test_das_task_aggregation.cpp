@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_DAS
+
+#include <gtest/gtest.h>
+#include "sql/das/ob_das_task.h"
+#include "sql/das/ob_das_factory.h"
+#include "sql/das/ob_das_delete_op.h"
+#include "sql/das/ob_das_dml_ctx_define.h"
+#include "sql/das/ob_das_rpc_processor.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_des_exec_context.h"
+#include "lib/allocator/page_arena.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+// An aggregated ObDASTaskArg carries several task ops of one DML operator, it must
+// arrive at the runner with every op in order and bound to the shared rtdef, and the
+// affected rows of each op come back in its own task result.
+class TestDASTaskAggregation : public ::testing::Test
+{
+public:
+  static const int64_t OP_CNT = 3;
+  static const int64_t BUF_LEN = 64 * 1024;
+
+  TestDASTaskAggregation()
+    : alloc_(ObModIds::TEST),
+      exec_ctx_(alloc_),
+      factory_(alloc_),
+      des_exec_ctx_(alloc_, nullptr),
+      recv_factory_(alloc_),
+      frame_info_(alloc_)
+  {
+  }
+
+  virtual void TearDown() override
+  {
+    ObDASRemoteInfo::get_remote_info() = nullptr;
+    ObDASSyncAccessP::get_das_factory() = nullptr;
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  ObExecContext exec_ctx_;
+  ObDASTaskFactory factory_;
+  ObDesExecContext des_exec_ctx_;
+  ObDASTaskFactory recv_factory_;
+  ObExprFrameInfo frame_info_;
+};
+
+TEST_F(TestDASTaskAggregation, multi_op_task_arg)
+{
+  ObDASBaseCtDef *ctdef = nullptr;
+  ObDASBaseRtDef *rtdef = nullptr;
+  ObDASRemoteInfo remote_info;
+  ObDASTaskArg task_arg;
+  remote_info.exec_ctx_ = &exec_ctx_;
+  ASSERT_EQ(OB_SUCCESS, ObDASTaskFactory::create_das_ctdef(DAS_OP_TABLE_DELETE, alloc_, ctdef));
+  ASSERT_EQ(OB_SUCCESS, ObDASTaskFactory::create_das_rtdef(DAS_OP_TABLE_DELETE, alloc_, rtdef));
+  ASSERT_EQ(OB_SUCCESS, remote_info.ctdefs_.push_back(ctdef));
+  ASSERT_EQ(OB_SUCCESS, remote_info.rtdefs_.push_back(rtdef));
+  // the task ops of one DML operator share its ctdef and rtdef
+  for (int64_t i = 0; i < OP_CNT; ++i) {
+    ObIDASTaskOp *task_op = nullptr;
+    ASSERT_EQ(OB_SUCCESS, factory_.create_das_task_op(DAS_OP_TABLE_DELETE, task_op));
+    ObDASDeleteOp *del_op = static_cast<ObDASDeleteOp*>(task_op);
+    del_op->set_tenant_id(OB_SYS_TENANT_ID);
+    del_op->set_task_id(100 + i);
+    del_op->set_tablet_id(ObTabletID(200001 + i));
+    del_op->set_ls_id(share::ObLSID(1001));
+    del_op->set_das_ctdef(static_cast<ObDASDelCtDef*>(ctdef));
+    del_op->set_das_rtdef(static_cast<ObDASDelRtDef*>(rtdef));
+    ASSERT_EQ(OB_SUCCESS, del_op->init_task_info());
+    ASSERT_EQ(OB_SUCCESS, task_arg.add_task_op(task_op));
+  }
+  task_arg.set_remote_info(&remote_info);
+  task_arg.set_timeout_ts(ObTimeUtility::current_time() + 10 * 1000 * 1000);
+  ObDASRemoteInfo::get_remote_info() = &remote_info;
+
+  char *buf = static_cast<char*>(alloc_.alloc(BUF_LEN));
+  ASSERT_TRUE(nullptr != buf);
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, task_arg.serialize(buf, BUF_LEN, pos));
+  ASSERT_EQ(task_arg.get_serialize_size(), pos);
+
+  // deserialize it as ObDASSyncAccessP does on the runner
+  ObDASRemoteInfo recv_info;
+  ObDASTaskArg recv_arg;
+  recv_info.exec_ctx_ = &des_exec_ctx_;
+  recv_info.frame_info_ = &frame_info_;
+  recv_arg.set_remote_info(&recv_info);
+  ObDASSyncAccessP::get_das_factory() = &recv_factory_;
+  ObDASRemoteInfo::get_remote_info() = &recv_info;
+  const int64_t data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, recv_arg.deserialize(buf, data_len, pos));
+  ASSERT_EQ(data_len, pos);
+
+  ObIArray<ObIDASTaskOp*> &recv_ops = recv_arg.get_task_ops();
+  ASSERT_TRUE(OP_CNT == recv_ops.count());
+  ASSERT_EQ(1, recv_info.ctdefs_.count());
+  ASSERT_EQ(1, recv_info.rtdefs_.count());
+  for (int64_t i = 0; i < OP_CNT; ++i) {
+    ObIDASTaskOp *recv_op = recv_ops.at(i);
+    ASSERT_TRUE(nullptr != recv_op);
+    ASSERT_EQ(DAS_OP_TABLE_DELETE, recv_op->get_type());
+    ASSERT_EQ(100 + i, recv_op->get_task_id());
+    ASSERT_EQ(ObTabletID(200001 + i), recv_op->get_tablet_id());
+    ASSERT_EQ(recv_info.ctdefs_.at(0), recv_op->get_ctdef());
+    ASSERT_EQ(recv_info.rtdefs_.at(0), recv_op->get_rtdef());
+  }
+
+  // the runner counts the affected rows of each op from 0 on the shared rtdef as
+  // ObDASSyncAccessP::process() does, the scheduler adds up the task results
+  ObDASDelRtDef *recv_rtdef = static_cast<ObDASDelRtDef*>(recv_info.rtdefs_.at(0));
+  ObDASDelRtDef *sched_rtdef = static_cast<ObDASDelRtDef*>(rtdef);
+  sched_rtdef->affected_rows_ = 0;
+  for (int64_t i = 0; i < OP_CNT; ++i) {
+    ObIDASTaskOp *recv_op = recv_ops.at(i);
+    ObIDASTaskResult *op_result = nullptr;
+    bool has_more = false;
+    ASSERT_EQ(OB_SUCCESS, recv_factory_.create_das_task_result(DAS_OP_TABLE_DELETE, op_result));
+    op_result->set_task_id(recv_op->get_task_id());
+    recv_rtdef->affected_rows_ = 0;
+    // rows deleted by the op
+    recv_rtdef->affected_rows_ += i + 1;
+    ASSERT_EQ(OB_SUCCESS, recv_op->fill_task_result(*op_result, has_more));
+    ASSERT_FALSE(has_more);
+    ASSERT_EQ(i + 1, static_cast<ObDASDeleteResult*>(op_result)->get_affected_rows());
+    ASSERT_EQ(OB_SUCCESS, task_arg.get_task_ops().at(i)->decode_task_result(op_result));
+  }
+  ASSERT_EQ(OP_CNT * (OP_CNT + 1) / 2, sched_rtdef->affected_rows_);
+}
+
+TEST_F(TestDASTaskAggregation, multi_op_task_resp)
+{
+  ObDASTaskResp task_resp;
+  ObDASTaskResp recv_resp;
+  for (int64_t i = 0; i < OP_CNT; ++i) {
+    ObIDASTaskResult *op_result = nullptr;
+    ObIDASTaskResult *recv_result = nullptr;
+    ASSERT_EQ(OB_SUCCESS, factory_.create_das_task_result(DAS_OP_TABLE_DELETE, op_result));
+    ASSERT_EQ(OB_SUCCESS, recv_factory_.create_das_task_result(DAS_OP_TABLE_DELETE, recv_result));
+    op_result->set_task_id(100 + i);
+    static_cast<ObDASDeleteResult*>(op_result)->set_affected_rows(i + 1);
+    ASSERT_EQ(OB_SUCCESS, task_resp.add_op_result(op_result));
+    ASSERT_EQ(OB_SUCCESS, recv_resp.add_op_result(recv_result));
+  }
+  char *buf = static_cast<char*>(alloc_.alloc(BUF_LEN));
+  ASSERT_TRUE(nullptr != buf);
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, task_resp.serialize(buf, BUF_LEN, pos));
+  ASSERT_EQ(task_resp.get_serialize_size(), pos);
+  const int64_t data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, recv_resp.deserialize(buf, data_len, pos));
+  ASSERT_EQ(data_len, pos);
+  for (int64_t i = 0; i < OP_CNT; ++i) {
+    ObIDASTaskResult *recv_result = recv_resp.get_op_results().at(i);
+    ASSERT_EQ(100 + i, recv_result->get_task_id());
+    ASSERT_EQ(i + 1, static_cast<ObDASDeleteResult*>(recv_result)->get_affected_rows());
+  }
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "sql/ob_sql_init.h"
+#define private public
+#include "sql/engine/cmd/ob_load_data_impl.h"
+#include "sql/engine/cmd/ob_load_data_rpc.h"
+#undef private
+
+using namespace oceanbase::sql;
+using namespace oceanbase::common;
+
+const int64_t ROUND_ROW_COUNT = 10000;
+const int64_t BATCH_ROW_COUNT = 100;
+
+// LOAD DATA shuffles the next round of the file while the rows of the previous round are
+// inserted, check the data frags of the two rounds buffered in one ObPartDataFragMgr.
+class TestLoadDataFrag : public ::testing::Test
+{
+public:
+  TestLoadDataFrag() : part_mgr_(frag_mgr_, OB_SYS_TENANT_ID, ObTabletID(200001)) {}
+  virtual void SetUp() override
+  {
+    frag_mgr_.attr_.tenant_id_ = OB_SYS_TENANT_ID;
+    frag_mgr_.attr_.label_ = ObModIds::OB_SQL_LOAD_DATA;
+    frag_mgr_.total_alloc_cnt_ = 0;
+    frag_mgr_.total_free_cnt_ = 0;
+  }
+
+  // encode the rows as ObLoadDataSPImpl::exec_shuffle does, with the line number as the
+  // value of the row, and save the full frags to the part frag mgr
+  int shuffle(const int64_t begin_line, const int64_t end_line)
+  {
+    int ret = OB_SUCCESS;
+    ObDataFrag *frag = NULL;
+    for (int64_t line = begin_line; OB_SUCC(ret) && line < end_line; line++) {
+      int64_t len = 0;
+      OB_UNIS_ADD_LEN(line);
+      const int64_t row_ser_size = len;
+      OB_UNIS_ADD_LEN(row_ser_size);
+      if (NULL != frag && (len > frag->get_remain() || frag->row_cnt >= ObDataFrag::MAX_ROW_COUNT)) {
+        ret = save_frag(frag);
+        frag = NULL;
+      }
+      if (OB_SUCC(ret) && NULL == frag) {
+        ret = frag_mgr_.create_datafrag(frag, len);
+      }
+      if (OB_SUCC(ret)) {
+        char *buf = frag->get_current();
+        const int64_t buf_len = frag->get_remain();
+        int64_t pos = 0;
+        OB_UNIS_ENCODE(row_ser_size);
+        OB_UNIS_ENCODE(line);
+        if (OB_SUCC(ret)) {
+          frag->add_pos(pos);
+          frag->add_row_cnt(1);
+        }
+      }
+    }
+    if (OB_SUCC(ret) && NULL != frag) {
+      ret = save_frag(frag);
+    }
+    return ret;
+  }
+
+  int save_frag(ObDataFrag *frag)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_FAIL(part_mgr_.queue_.push(frag))) {
+      frag_mgr_.distory_datafrag(frag);
+    } else {
+      ATOMIC_AAF(&part_mgr_.total_row_proceduced_, frag->row_cnt);
+    }
+    return ret;
+  }
+
+  // generate the insert tasks of a round and free the frags consumed, return the line
+  // numbers of the rows in the tasks
+  int insert(const int64_t row_count, ObIArray<int64_t> &lines)
+  {
+    int ret = OB_SUCCESS;
+    ObInsertTask task;
+    for (int64_t consumed = 0; OB_SUCC(ret) && consumed < row_count; consumed += BATCH_ROW_COUNT) {
+      task.reuse();
+      if (OB_FAIL(part_mgr_.next_insert_task(BATCH_ROW_COUNT, task))) {
+        LOG_WARN("next insert task failed", K(ret));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < task.insert_value_data_.count(); i++) {
+        const char *buf = task.insert_value_data_.at(i).ptr();
+        const int64_t data_len = task.insert_value_data_.at(i).length();
+        int64_t pos = 0;
+        while (OB_SUCC(ret) && pos < data_len) {
+          int64_t row_ser_size = 0;
+          int64_t line = 0;
+          OB_UNIS_DECODE(row_ser_size);
+          OB_UNIS_DECODE(line);
+          if (OB_SUCC(ret) && OB_FAIL(lines.push_back(line))) {
+            LOG_WARN("push back failed", K(ret));
+          }
+        }
+      }
+    }
+    if (OB_SUCC(ret) && OB_FAIL(part_mgr_.free_frags())) {
+      LOG_WARN("free frags failed", K(ret));
+    }
+    return ret;
+  }
+
+protected:
+  ObDataFragMgr frag_mgr_;
+  ObPartDataFragMgr part_mgr_;
+};
+
+TEST_F(TestLoadDataFrag, insert_while_shuffle_next_round)
+{
+  ObArray<int64_t> lines;
+  // round 0 is shuffled
+  ASSERT_EQ(OB_SUCCESS, shuffle(0, ROUND_ROW_COUNT));
+  // round 1 is shuffled while round 0 is inserted
+  int shuffle_ret = OB_SUCCESS;
+  std::thread shuffle_thread([&]() {
+    shuffle_ret = shuffle(ROUND_ROW_COUNT, 2 * ROUND_ROW_COUNT);
+  });
+  int insert_ret = insert(ROUND_ROW_COUNT, lines);
+  shuffle_thread.join();
+  ASSERT_EQ(OB_SUCCESS, shuffle_ret);
+  ASSERT_EQ(OB_SUCCESS, insert_ret);
+  // the rows of round 1 are not taken by the inserts of round 0
+  ASSERT_EQ(ROUND_ROW_COUNT, lines.count());
+  for (int64_t i = 0; i < lines.count(); i++) {
+    ASSERT_EQ(i, lines.at(i));
+  }
+  EXPECT_EQ(ROUND_ROW_COUNT, part_mgr_.remain_row_count());
+
+  // round 1 is inserted after the shuffle of it
+  lines.reuse();
+  ASSERT_EQ(OB_SUCCESS, insert(ROUND_ROW_COUNT, lines));
+  ASSERT_EQ(ROUND_ROW_COUNT, lines.count());
+  for (int64_t i = 0; i < lines.count(); i++) {
+    ASSERT_EQ(ROUND_ROW_COUNT + i, lines.at(i));
+  }
+  EXPECT_EQ(0, part_mgr_.remain_row_count());
+  ASSERT_EQ(OB_SUCCESS, part_mgr_.clear());
+  // every frag is freed exactly once, though the two rounds free frags concurrently
+  EXPECT_LT(0, frag_mgr_.get_total_allocated_frag_count());
+  EXPECT_EQ(frag_mgr_.get_total_allocated_frag_count(), frag_mgr_.get_total_freed_frag_count());
+}
+
+TEST_F(TestLoadDataFrag, free_frags_concurrently)
+{
+  const int64_t THREAD_COUNT = 4;
+  const int64_t FRAG_COUNT = 10000;
+  std::vector<std::thread> threads;
+  for (int64_t i = 0; i < THREAD_COUNT; i++) {
+    threads.push_back(std::thread([&]() {
+      for (int64_t j = 0; j < FRAG_COUNT; j++) {
+        ObDataFrag *frag = NULL;
+        if (OB_SUCCESS == frag_mgr_.create_datafrag(frag, 16)) {
+          frag_mgr_.distory_datafrag(frag);
+        }
+      }
+    }));
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(THREAD_COUNT * FRAG_COUNT, frag_mgr_.get_total_allocated_frag_count());
+  EXPECT_EQ(THREAD_COUNT * FRAG_COUNT, frag_mgr_.get_total_freed_frag_count());
+}
+
+int main(int argc, char **argv)
+{
+  init_sql_factories();
+  system("rm -f test_load_data_frag.log*");
+  OB_LOGGER.set_file_name("test_load_data_frag.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_EXE
+
+#include <gtest/gtest.h>
+#include "sql/ob_sql_init.h"
+#include "lib/allocator/page_arena.h"
+#define private public
+#include "sql/engine/px/ob_granule_util.h"
+#undef private
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+const int64_t TABLET_COUNT = 6;
+
+// The partition granules of the GI shared pool are handed out from the largest partition.
+class TestGranuleUtil : public ::testing::Test
+{
+public:
+  TestGranuleUtil() : alloc_(ObModIds::TEST) {}
+  virtual void SetUp() override
+  {
+    for (int64_t i = 0; i < TABLET_COUNT; i++) {
+      tablet_locs_[i].tablet_id_ = ObTabletID(200001 + i);
+      ASSERT_EQ(OB_SUCCESS, tablets_.push_back(&tablet_locs_[i]));
+    }
+  }
+
+  // split the partition granules of tablets_ without sorting them by size
+  void split_partition_granule(const ObIArray<ObNewRange> &ranges,
+                               const int64_t parallelism,
+                               const bool large_partition_first)
+  {
+    ObSEArray<ObDASTabletLoc*, 16> granule_tablets;
+    ObSEArray<ObNewRange, 16> granule_ranges;
+    ObSEArray<int64_t, 16> granule_idx;
+    ASSERT_EQ(OB_SUCCESS, ObGranuleUtil::split_block_ranges(alloc_,
+                                                            NULL,
+                                                            ranges,
+                                                            tablets_,
+                                                            parallelism,
+                                                            0,
+                                                            true,
+                                                            granule_tablets,
+                                                            granule_ranges,
+                                                            granule_idx,
+                                                            false,
+                                                            large_partition_first));
+    ASSERT_EQ(TABLET_COUNT * ranges.count(), granule_tablets.count());
+    for (int64_t i = 0; i < granule_tablets.count(); i++) {
+      EXPECT_EQ(tablets_.at(i / ranges.count()), granule_tablets.at(i)) << "granule: " << i;
+      EXPECT_EQ(i / ranges.count(), granule_idx.at(i)) << "granule: " << i;
+    }
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  ObDASTabletLoc tablet_locs_[TABLET_COUNT];
+  ObSEArray<ObDASTabletLoc*, TABLET_COUNT> tablets_;
+};
+
+TEST_F(TestGranuleUtil, order_tablets_by_size)
+{
+  // the partitions of the same size keep their original order
+  int64_t sizes[TABLET_COUNT] = { 10, 300, 20, 300, 0, 20 };
+  int64_t expect_order[TABLET_COUNT] = { 1, 3, 2, 5, 0, 4 };
+  ObSEArray<int64_t, TABLET_COUNT> tablet_sizes;
+  ObSEArray<ObDASTabletLoc*, TABLET_COUNT> sorted_tablets;
+  for (int64_t i = 0; i < TABLET_COUNT; i++) {
+    ASSERT_EQ(OB_SUCCESS, tablet_sizes.push_back(sizes[i]));
+  }
+  ASSERT_EQ(OB_SUCCESS, ObGranuleUtil::order_tablets_by_size(tablet_sizes, tablets_, sorted_tablets));
+  ASSERT_EQ(TABLET_COUNT, sorted_tablets.count());
+  for (int64_t i = 0; i < TABLET_COUNT; i++) {
+    EXPECT_EQ(&tablet_locs_[expect_order[i]], sorted_tablets.at(i)) << "idx: " << i;
+  }
+
+  // sizes of all the tablets are needed
+  tablet_sizes.pop_back();
+  EXPECT_EQ(OB_INVALID_ARGUMENT, ObGranuleUtil::order_tablets_by_size(tablet_sizes, tablets_,
+                                                                      sorted_tablets));
+}
+
+TEST_F(TestGranuleUtil, keep_tablet_order)
+{
+  ObSEArray<ObNewRange, 2> ranges;
+  ObNewRange range;
+  range.set_whole_range();
+  ASSERT_EQ(OB_SUCCESS, ranges.push_back(range));
+  // no order requirement is given
+  split_partition_granule(ranges, 2, false);
+  // no more partitions than workers, every worker takes one partition at once
+  split_partition_granule(ranges, TABLET_COUNT, true);
+
+  // no data to scan
+  ranges.reset();
+  range.set_false_range();
+  ASSERT_EQ(OB_SUCCESS, ranges.push_back(range));
+  ASSERT_EQ(OB_SUCCESS, ranges.push_back(range));
+  split_partition_granule(ranges, 2, true);
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  oceanbase::sql::init_sql_factories();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_EXE
+
+#include <gtest/gtest.h>
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/expr/ob_expr.h"
+#include "share/datum/ob_datum_funcs.h"
+#include "lib/allocator/page_arena.h"
+#define private public
+#define protected public
+#include "sql/executor/ob_slice_calc.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+// Compare the slice indexes of the vectorized hash slice calculation with the row by row
+// calculation, when the rows with null keys are dropped or distributed randomly.
+class TestHashSliceCalc : public ::testing::Test
+{
+public:
+  static const int64_t BATCH_SIZE = 64;
+  static const int64_t TASK_CNT = 7;
+
+  TestHashSliceCalc()
+    : alloc_(ObModIds::TEST),
+      exec_ctx_(alloc_),
+      eval_ctx_(exec_ctx_),
+      frame_(NULL),
+      pos_(0),
+      skip_(NULL)
+  {
+  }
+
+  virtual void SetUp() override
+  {
+    const int64_t frame_size = 2 * (sizeof(ObEvalInfo)
+        + BATCH_SIZE * (sizeof(ObDatum) + sizeof(int64_t))
+        + 2 * ObBitVector::memory_size(BATCH_SIZE));
+    frame_ = static_cast<char *>(alloc_.alloc(frame_size));
+    ASSERT_TRUE(NULL != frame_);
+    memset(frame_, 0, frame_size);
+    eval_ctx_.frames_ = static_cast<char **>(alloc_.alloc(sizeof(char *)));
+    ASSERT_TRUE(NULL != eval_ctx_.frames_);
+    eval_ctx_.frames_[0] = frame_;
+    eval_ctx_.set_max_batch_size(BATCH_SIZE);
+
+    skip_ = to_bit_vector(alloc_.alloc(ObBitVector::memory_size(BATCH_SIZE)));
+    ASSERT_TRUE(NULL != skip_);
+    skip_->reset(BATCH_SIZE);
+    // the rows filtered by the child operator
+    skip_->set(1);
+    skip_->set(10);
+
+    // k1: NULL every 3 rows, k2: NULL every 13 rows
+    ObExpr *keys[] = { &k1_, &k2_ };
+    for (int64_t k = 0; k < 2; k++) {
+      init_expr(*keys[k]);
+      ObDatum *datums = keys[k]->locate_batch_datums(eval_ctx_);
+      for (int64_t i = 0; i < BATCH_SIZE; i++) {
+        if (0 == i % (0 == k ? 3 : 13)) {
+          datums[i].set_null();
+        } else {
+          datums[i].set_int(i * (k + 1));
+        }
+      }
+      keys[k]->get_eval_info(eval_ctx_).evaluated_ = true;
+      keys[k]->get_eval_info(eval_ctx_).projected_ = true;
+      ASSERT_EQ(OB_SUCCESS, dist_exprs_.push_back(keys[k]));
+      ObHashFunc hash_func;
+      hash_func.hash_func_ = keys[k]->basic_funcs_->murmur_hash_;
+      hash_func.batch_hash_func_ = keys[k]->basic_funcs_->murmur_hash_batch_;
+      ASSERT_EQ(OB_SUCCESS, hash_funcs_.push_back(hash_func));
+    }
+  }
+
+  void init_expr(ObExpr &expr)
+  {
+    expr.frame_idx_ = 0;
+    expr.batch_result_ = true;
+    expr.batch_idx_mask_ = UINT64_MAX;
+    expr.datum_meta_.type_ = ObIntType;
+    expr.obj_meta_.set_int();
+    expr.basic_funcs_ = ObDatumFuncs::get_basic_func(ObIntType, CS_TYPE_BINARY, false);
+    expr.res_buf_len_ = sizeof(int64_t);
+    expr.datum_off_ = static_cast<uint32_t>(pos_);
+    pos_ += sizeof(ObDatum) * BATCH_SIZE;
+    expr.eval_info_off_ = static_cast<uint32_t>(pos_);
+    pos_ += sizeof(ObEvalInfo);
+    expr.eval_flags_off_ = static_cast<uint32_t>(pos_);
+    pos_ += ObBitVector::memory_size(BATCH_SIZE);
+    expr.pvt_skip_off_ = static_cast<uint32_t>(pos_);
+    pos_ += ObBitVector::memory_size(BATCH_SIZE);
+    expr.res_buf_off_ = static_cast<uint32_t>(pos_);
+    pos_ += expr.res_buf_len_ * BATCH_SIZE;
+    expr.reset_datums_ptr(frame_, BATCH_SIZE);
+  }
+
+  void check_slice_idx(const ObNullDistributeMethod::Type null_row_dist_method)
+  {
+    ObHashSliceIdCalc vec_calc(alloc_, TASK_CNT, null_row_dist_method, &dist_exprs_, &hash_funcs_);
+    ObHashSliceIdCalc row_calc(alloc_, TASK_CNT, null_row_dist_method, &dist_exprs_, &hash_funcs_);
+    ASSERT_TRUE(vec_calc.support_vectorized_calc());
+
+    int64_t *indexes = NULL;
+    ASSERT_EQ(OB_SUCCESS, vec_calc.get_slice_idx_vec(dist_exprs_, eval_ctx_, *skip_,
+        BATCH_SIZE, indexes));
+    ASSERT_TRUE(NULL != indexes);
+
+    int64_t null_rows = 0;
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(eval_ctx_);
+    batch_info_guard.set_batch_size(BATCH_SIZE);
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      if (skip_->at(i)) {
+        continue;
+      }
+      batch_info_guard.set_batch_idx(i);
+      int64_t slice_idx = -1;
+      ASSERT_EQ(OB_SUCCESS, row_calc.get_slice_idx(dist_exprs_, eval_ctx_, slice_idx));
+      EXPECT_EQ(slice_idx, indexes[i]) << "row: " << i;
+      const bool has_null_key = 0 == i % 3 || 0 == i % 13;
+      if (has_null_key) {
+        null_rows += 1;
+        if (ObNullDistributeMethod::DROP == null_row_dist_method) {
+          EXPECT_EQ(ObSliceIdxCalc::DEFAULT_CHANNEL_IDX_TO_DROP_ROW + 0, indexes[i]) << "row: " << i;
+        }
+      }
+      if (!has_null_key || ObNullDistributeMethod::DROP != null_row_dist_method) {
+        EXPECT_LE(0, indexes[i]) << "row: " << i;
+        EXPECT_GT(TASK_CNT + 0, indexes[i]) << "row: " << i;
+      }
+    }
+    EXPECT_LT(0, null_rows);
+    if (ObNullDistributeMethod::RANDOM == null_row_dist_method) {
+      EXPECT_EQ(null_rows, vec_calc.round_robin_idx_);
+    }
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  char *frame_;
+  int64_t pos_;
+  ObBitVector *skip_;
+  ObExpr k1_;
+  ObExpr k2_;
+  ObSEArray<ObExpr *, 2> dist_exprs_;
+  ObSEArray<ObHashFunc, 2> hash_funcs_;
+};
+
+TEST_F(TestHashSliceCalc, vectorized_with_null_keys)
+{
+  check_slice_idx(ObNullDistributeMethod::NONE);
+  check_slice_idx(ObNullDistributeMethod::DROP);
+  check_slice_idx(ObNullDistributeMethod::RANDOM);
+}
+
+TEST_F(TestHashSliceCalc, support_vectorized_calc)
+{
+  ObExprCtx expr_ctx;
+  ObSEArray<ObHashColumn, 1> hash_columns;
+  ObSEArray<ObSqlExpression *, 1> sql_exprs;
+  ObHashSliceIdCalc old_engine_calc(alloc_, expr_ctx, ObNullDistributeMethod::DROP,
+      hash_columns, sql_exprs, TASK_CNT);
+  ObHashSliceIdCalc calc(alloc_, TASK_CNT, ObNullDistributeMethod::DROP,
+      &dist_exprs_, &hash_funcs_);
+  EXPECT_TRUE(old_engine_calc.support_vectorized_calc());
+  EXPECT_TRUE(calc.support_vectorized_calc());
+  // the old engine calc has no static typing exprs to calculate in batch
+  int64_t *indexes = NULL;
+  EXPECT_EQ(OB_NOT_INIT, old_engine_calc.get_slice_idx_vec(dist_exprs_, eval_ctx_, *skip_,
+      BATCH_SIZE, indexes));
+}
+
+} // namespace sql
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_hash_slice_calc.log*");
+  OB_LOGGER.set_file_name("test_hash_slice_calc.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_EXE
+
+#include <gtest/gtest.h>
+#include "lib/allocator/page_arena.h"
+#include "lib/hash_func/murmur_hash.h"
+#define private public
+#include "sql/engine/px/ob_px_bloom_filter.h"
+#undef private
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+// The int key range of the join filter is tracked by the create side, merged with the
+// bits pieces, and reset with the filter.
+class TestPxBloomFilter : public ::testing::Test
+{
+public:
+  TestPxBloomFilter() : alloc_(ObModIds::TEST) {}
+  virtual void SetUp() override
+  {
+    ASSERT_EQ(OB_SUCCESS, init_filter(filter_));
+  }
+
+  int init_filter(ObPxBloomFilter &filter)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_FAIL(filter.init(1024, alloc_))) {
+      LOG_WARN("init filter failed", K(ret));
+    } else {
+      filter.set_begin_idx(0);
+      filter.set_end_idx(filter.get_bits_array_length() - 1);
+    }
+    return ret;
+  }
+
+  // build a filter piece of the keys in [min_val, max_val]
+  int build_piece(ObPxBloomFilter &piece, const bool with_range, const int64_t min_val,
+                  const int64_t max_val)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_FAIL(init_filter(piece))) {
+    } else if (with_range) {
+      piece.enable_int_range();
+      piece.update_int_range(min_val, max_val);
+    }
+    for (int64_t v = min_val; OB_SUCC(ret) && v <= max_val; v++) {
+      ret = piece.put(murmurhash(&v, sizeof(v), 0));
+    }
+    return ret;
+  }
+
+  bool might_contain(ObPxBloomFilter &filter, const int64_t v)
+  {
+    bool is_match = false;
+    EXPECT_EQ(OB_SUCCESS, filter.might_contain(murmurhash(&v, sizeof(v), 0), is_match));
+    return is_match;
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  ObPxBloomFilter filter_;
+};
+
+TEST_F(TestPxBloomFilter, track_int_range)
+{
+  EXPECT_FALSE(filter_.has_int_range());
+  filter_.enable_int_range();
+  ASSERT_TRUE(filter_.has_int_range());
+  // no key is built, every probe value is out of range
+  EXPECT_TRUE(filter_.is_out_of_int_range(0));
+
+  filter_.update_int_range(10, 20);
+  filter_.update_int_range(-5, 0);
+  filter_.update_int_range(15, 15);
+  EXPECT_TRUE(filter_.is_out_of_int_range(-6));
+  EXPECT_FALSE(filter_.is_out_of_int_range(-5));
+  EXPECT_FALSE(filter_.is_out_of_int_range(5));
+  EXPECT_FALSE(filter_.is_out_of_int_range(20));
+  EXPECT_TRUE(filter_.is_out_of_int_range(21));
+}
+
+TEST_F(TestPxBloomFilter, merge_int_range)
+{
+  ObPxBloomFilter piece1;
+  ObPxBloomFilter piece2;
+  ObPxBloomFilter old_piece;
+  ASSERT_EQ(OB_SUCCESS, build_piece(piece1, true, 1, 10));
+  ASSERT_EQ(OB_SUCCESS, build_piece(piece2, true, 100, 110));
+  ASSERT_EQ(OB_SUCCESS, build_piece(old_piece, false, 1000, 1010));
+
+  ASSERT_EQ(OB_SUCCESS, filter_.merge_filter(&piece1));
+  ASSERT_EQ(OB_SUCCESS, filter_.merge_filter(&piece2));
+  ASSERT_TRUE(filter_.has_int_range());
+  EXPECT_TRUE(filter_.is_out_of_int_range(0));
+  EXPECT_FALSE(filter_.is_out_of_int_range(50));
+  EXPECT_TRUE(filter_.is_out_of_int_range(111));
+  for (int64_t v = 1; v <= 10; v++) {
+    EXPECT_TRUE(might_contain(filter_, v)) << "value: " << v;
+  }
+
+  // a piece sent by an old server has no range, the range can't be used any more
+  ASSERT_EQ(OB_SUCCESS, filter_.merge_filter(&old_piece));
+  EXPECT_FALSE(filter_.has_int_range());
+  ASSERT_EQ(OB_SUCCESS, filter_.merge_filter(&piece1));
+  EXPECT_FALSE(filter_.has_int_range());
+  for (int64_t v = 1000; v <= 1010; v++) {
+    EXPECT_TRUE(might_contain(filter_, v)) << "value: " << v;
+  }
+}
+
+TEST_F(TestPxBloomFilter, reset_int_range)
+{
+  ObPxBloomFilter old_piece;
+  ObPxBloomFilter piece;
+  ASSERT_EQ(OB_SUCCESS, build_piece(old_piece, false, 1, 10));
+  ASSERT_EQ(OB_SUCCESS, build_piece(piece, true, 100, 110));
+  ASSERT_EQ(OB_SUCCESS, filter_.merge_filter(&old_piece));
+  ASSERT_FALSE(filter_.has_int_range());
+
+  // the filter is reused, e.g. by the rescan of the create side or a reused message
+  filter_.reset_filter();
+  EXPECT_EQ(ObPxBloomFilter::RANGE_INIT + 0, filter_.range_state_);
+  EXPECT_FALSE(might_contain(filter_, 1));
+  ASSERT_EQ(OB_SUCCESS, filter_.merge_filter(&piece));
+  ASSERT_TRUE(filter_.has_int_range());
+  EXPECT_TRUE(filter_.is_out_of_int_range(10));
+  EXPECT_FALSE(filter_.is_out_of_int_range(105));
+
+  // the range of the last build is not kept by the rescan of the create side
+  filter_.reset_filter();
+  EXPECT_FALSE(filter_.has_int_range());
+  filter_.enable_int_range();
+  filter_.update_int_range(1, 1);
+  EXPECT_TRUE(filter_.is_out_of_int_range(105));
+  EXPECT_FALSE(filter_.is_out_of_int_range(1));
+}
+
+TEST_F(TestPxBloomFilter, serialize_int_range)
+{
+  ObPxBloomFilter piece;
+  ASSERT_EQ(OB_SUCCESS, build_piece(piece, true, 1, 10));
+  const int64_t buf_len = piece.get_serialize_size_();
+  char *buf = static_cast<char *>(alloc_.alloc(buf_len));
+  ASSERT_TRUE(NULL != buf);
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, piece.serialize_(buf, buf_len, pos));
+  ASSERT_EQ(buf_len, pos);
+
+  ObPxBloomFilter decoded;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, decoded.deserialize_(buf, buf_len, pos));
+  ASSERT_TRUE(decoded.has_int_range());
+  EXPECT_TRUE(decoded.is_out_of_int_range(0));
+  EXPECT_FALSE(decoded.is_out_of_int_range(10));
+
+  // an old server sends the bits only, a reused filter doesn't keep the stale range
+  const int64_t range_len = serialization::encoded_length(piece.range_state_)
+      + serialization::encoded_length(piece.range_min_)
+      + serialization::encoded_length(piece.range_max_);
+  decoded.reset_filter();
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, decoded.deserialize_(buf, buf_len - range_len, pos));
+  EXPECT_EQ(buf_len - range_len, pos);
+  EXPECT_FALSE(decoded.has_int_range());
+  EXPECT_TRUE(might_contain(decoded, 5));
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
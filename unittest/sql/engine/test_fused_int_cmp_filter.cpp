@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#include "sql/engine/ob_operator.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/expr/ob_expr.h"
+#include "sql/engine/expr/ob_expr_cmp_func.h"
+#include "lib/allocator/page_arena.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+// Compare the fused int compare filter with the normal path: evaluate the compare expr
+// by its batch function, then filter NULL and zero results.
+class TestFusedIntCmpFilter : public ::testing::Test
+{
+public:
+  static const int64_t BATCH_SIZE = 64;
+
+  TestFusedIntCmpFilter()
+    : alloc_(ObModIds::TEST),
+      exec_ctx_(alloc_),
+      eval_ctx_(exec_ctx_),
+      frame_(NULL),
+      pos_(0),
+      fused_skip_(NULL),
+      unfused_skip_(NULL)
+  {
+  }
+
+  virtual void SetUp() override
+  {
+    const int64_t frame_size = 3 * (sizeof(ObEvalInfo)
+        + BATCH_SIZE * (sizeof(ObDatum) + sizeof(int64_t))
+        + 2 * ObBitVector::memory_size(BATCH_SIZE));
+    frame_ = static_cast<char *>(alloc_.alloc(frame_size));
+    ASSERT_TRUE(NULL != frame_);
+    memset(frame_, 0, frame_size);
+    eval_ctx_.frames_ = static_cast<char **>(alloc_.alloc(sizeof(char *)));
+    ASSERT_TRUE(NULL != eval_ctx_.frames_);
+    eval_ctx_.frames_[0] = frame_;
+    eval_ctx_.set_max_batch_size(BATCH_SIZE);
+
+    init_expr(left_);
+    init_expr(right_);
+    init_expr(cmp_);
+    args_[0] = &left_;
+    args_[1] = &right_;
+    cmp_.args_ = args_;
+    cmp_.arg_cnt_ = 2;
+
+    fused_skip_ = to_bit_vector(alloc_.alloc(ObBitVector::memory_size(BATCH_SIZE)));
+    unfused_skip_ = to_bit_vector(alloc_.alloc(ObBitVector::memory_size(BATCH_SIZE)));
+    ASSERT_TRUE(NULL != fused_skip_ && NULL != unfused_skip_);
+
+    // left: i % 7 - 3, NULL every 5 rows; right: 0, NULL every 11 rows
+    ObDatum *l = left_.locate_batch_datums(eval_ctx_);
+    ObDatum *r = right_.locate_batch_datums(eval_ctx_);
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      if (0 == i % 5) {
+        l[i].set_null();
+      } else {
+        l[i].set_int(i % 7 - 3);
+      }
+      if (0 == i % 11) {
+        r[i].set_null();
+      } else {
+        r[i].set_int(0);
+      }
+    }
+    left_.get_eval_info(eval_ctx_).evaluated_ = true;
+    left_.get_eval_info(eval_ctx_).projected_ = true;
+    right_.get_eval_info(eval_ctx_).evaluated_ = true;
+    right_.get_eval_info(eval_ctx_).projected_ = true;
+  }
+
+  void init_expr(ObExpr &expr)
+  {
+    expr.frame_idx_ = 0;
+    expr.batch_result_ = true;
+    expr.batch_idx_mask_ = UINT64_MAX;
+    expr.datum_meta_.type_ = ObIntType;
+    expr.obj_meta_.set_int();
+    expr.res_buf_len_ = sizeof(int64_t);
+    expr.datum_off_ = static_cast<uint32_t>(pos_);
+    pos_ += sizeof(ObDatum) * BATCH_SIZE;
+    expr.eval_info_off_ = static_cast<uint32_t>(pos_);
+    pos_ += sizeof(ObEvalInfo);
+    expr.eval_flags_off_ = static_cast<uint32_t>(pos_);
+    pos_ += ObBitVector::memory_size(BATCH_SIZE);
+    expr.pvt_skip_off_ = static_cast<uint32_t>(pos_);
+    pos_ += ObBitVector::memory_size(BATCH_SIZE);
+    expr.res_buf_off_ = static_cast<uint32_t>(pos_);
+    pos_ += expr.res_buf_len_ * BATCH_SIZE;
+    expr.reset_datums_ptr(frame_, BATCH_SIZE);
+  }
+
+  void check_cmp(const ObItemType type, const ObCmpOp cmp_op)
+  {
+    cmp_.type_ = type;
+    cmp_.eval_batch_func_ = ObExprCmpFuncsHelper::get_eval_batch_expr_cmp_func(
+        ObIntType, ObIntType, cmp_op, false, CS_TYPE_BINARY);
+    ASSERT_TRUE(NULL != cmp_.eval_batch_func_);
+    ASSERT_TRUE(ObOperator::is_fused_int_cmp_filter(cmp_));
+
+    // the first rows are filtered by the earlier filters
+    fused_skip_->reset(BATCH_SIZE);
+    fused_skip_->set(0);
+    fused_skip_->set(3);
+    unfused_skip_->deep_copy(*fused_skip_, BATCH_SIZE);
+
+    bool fused_all_filtered = false;
+    ASSERT_EQ(OB_SUCCESS, ObOperator::eval_fused_int_cmp_filter(
+        cmp_, eval_ctx_, *fused_skip_, BATCH_SIZE, fused_all_filtered));
+
+    cmp_.get_eval_info(eval_ctx_).clear_evaluated_flag();
+    ASSERT_EQ(OB_SUCCESS, cmp_.eval_batch(eval_ctx_, *unfused_skip_, BATCH_SIZE));
+    int64_t output_rows = 0;
+    const ObDatum *datums = cmp_.locate_batch_datums(eval_ctx_);
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      if (!unfused_skip_->at(i)) {
+        if (datums[i].null_ || 0 == *datums[i].int_) {
+          unfused_skip_->set(i);
+        } else {
+          output_rows += 1;
+        }
+      }
+    }
+
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      ASSERT_EQ(unfused_skip_->at(i), fused_skip_->at(i)) << "type: " << type << ", row: " << i;
+    }
+    ASSERT_EQ(0 == output_rows, fused_all_filtered);
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  char *frame_;
+  int64_t pos_;
+  ObExpr left_;
+  ObExpr right_;
+  ObExpr cmp_;
+  ObExpr *args_[2];
+  ObBitVector *fused_skip_;
+  ObBitVector *unfused_skip_;
+};
+
+TEST_F(TestFusedIntCmpFilter, fused_types)
+{
+  cmp_.arg_cnt_ = 2;
+  cmp_.type_ = T_OP_NE;
+  ASSERT_TRUE(ObOperator::is_fused_int_cmp_filter(cmp_));
+  cmp_.type_ = T_OP_NSEQ;
+  ASSERT_FALSE(ObOperator::is_fused_int_cmp_filter(cmp_));
+  cmp_.type_ = T_OP_LIKE;
+  ASSERT_FALSE(ObOperator::is_fused_int_cmp_filter(cmp_));
+  cmp_.type_ = T_OP_EQ;
+  right_.datum_meta_.type_ = ObVarcharType;
+  ASSERT_FALSE(ObOperator::is_fused_int_cmp_filter(cmp_));
+}
+
+TEST_F(TestFusedIntCmpFilter, same_as_unfused)
+{
+  check_cmp(T_OP_EQ, CO_EQ);
+  check_cmp(T_OP_NE, CO_NE);
+  check_cmp(T_OP_LT, CO_LT);
+  check_cmp(T_OP_LE, CO_LE);
+  check_cmp(T_OP_GT, CO_GT);
+  check_cmp(T_OP_GE, CO_GE);
+}
+
+TEST_F(TestFusedIntCmpFilter, all_null)
+{
+  ObDatum *l = left_.locate_batch_datums(eval_ctx_);
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    l[i].set_null();
+  }
+  left_.get_eval_info(eval_ctx_).notnull_ = false;
+  check_cmp(T_OP_NE, CO_NE);
+  check_cmp(T_OP_EQ, CO_EQ);
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
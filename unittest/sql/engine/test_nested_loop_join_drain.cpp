@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#include "sql/engine/ob_exec_context.h"
+#include "lib/allocator/page_arena.h"
+#define private public
+#define protected public
+#include "sql/engine/join/ob_nested_loop_join_op.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+const int64_t BATCH_SIZE = 4;
+
+// The right child of the join in group rescan, returns the rest rows of the current group.
+class MockRightOp : public ObOperator
+{
+public:
+  MockRightOp(ObExecContext &exec_ctx, const ObOpSpec &spec)
+    : ObOperator(exec_ctx, spec, NULL), remain_rows_(0), read_rows_(0), read_times_(0),
+      fail_ret_(OB_SUCCESS)
+  {
+  }
+  virtual int get_next_row() override
+  {
+    int ret = OB_SUCCESS;
+    read_times_++;
+    if (OB_SUCCESS != fail_ret_) {
+      ret = fail_ret_;
+    } else if (remain_rows_ <= 0) {
+      ret = OB_ITER_END;
+    } else {
+      remain_rows_--;
+      read_rows_++;
+    }
+    return ret;
+  }
+  virtual int get_next_batch(const int64_t max_row_cnt, const ObBatchRows *&batch_rows) override
+  {
+    int ret = OB_SUCCESS;
+    read_times_++;
+    if (OB_SUCCESS != fail_ret_) {
+      ret = fail_ret_;
+    } else {
+      brs_.size_ = min(max_row_cnt, remain_rows_);
+      brs_.end_ = 0 == brs_.size_;
+      remain_rows_ -= brs_.size_;
+      read_rows_ += brs_.size_;
+      batch_rows = &brs_;
+    }
+    return ret;
+  }
+  virtual int inner_get_next_row() override { return OB_NOT_IMPLEMENT; }
+  virtual void destroy() override { ObOperator::destroy(); }
+
+  int64_t remain_rows_;
+  int64_t read_rows_;
+  int64_t read_times_;
+  int fail_ret_;
+};
+
+// Semi/anti join stops at the first match of a left row, the rest rows of the group must
+// be consumed before the right child switches to the group of the next left row.
+class TestNestedLoopJoinDrain : public ::testing::Test
+{
+public:
+  TestNestedLoopJoinDrain()
+    : alloc_(ObModIds::TEST),
+      exec_ctx_(alloc_),
+      join_spec_(alloc_, PHY_NESTED_LOOP_JOIN),
+      right_spec_(alloc_, PHY_FAKE_TABLE),
+      join_op_(exec_ctx_, join_spec_, NULL),
+      right_op_(exec_ctx_, right_spec_)
+  {
+  }
+
+  virtual void SetUp() override
+  {
+    join_spec_.use_group_ = true;
+    join_spec_.join_type_ = LEFT_SEMI_JOIN;
+    join_op_.right_ = &right_op_;
+  }
+
+  void set_vectorized()
+  {
+    join_spec_.max_batch_size_ = BATCH_SIZE;
+    right_spec_.max_batch_size_ = BATCH_SIZE;
+    join_op_.op_max_batch_size_ = BATCH_SIZE;
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  ObExecContext exec_ctx_;
+  ObNestedLoopJoinSpec join_spec_;
+  ObOpSpec right_spec_;
+  ObNestedLoopJoinOp join_op_;
+  MockRightOp right_op_;
+};
+
+TEST_F(TestNestedLoopJoinDrain, drain_rows)
+{
+  right_op_.remain_rows_ = 10;
+  ASSERT_EQ(OB_SUCCESS, join_op_.drain_right_group());
+  EXPECT_EQ(0, right_op_.remain_rows_);
+  EXPECT_EQ(10, right_op_.read_rows_);
+  EXPECT_EQ(11, right_op_.read_times_);
+
+  // the matched row is the last one of the group
+  right_op_.read_times_ = 0;
+  ASSERT_EQ(OB_SUCCESS, join_op_.drain_right_group());
+  EXPECT_EQ(1, right_op_.read_times_);
+
+  right_op_.remain_rows_ = 3;
+  right_op_.fail_ret_ = OB_ERR_UNEXPECTED;
+  EXPECT_EQ(OB_ERR_UNEXPECTED, join_op_.drain_right_group());
+  EXPECT_EQ(3, right_op_.remain_rows_);
+}
+
+TEST_F(TestNestedLoopJoinDrain, drain_batches)
+{
+  set_vectorized();
+  ASSERT_TRUE(join_op_.is_vectorized());
+  right_op_.remain_rows_ = 10;
+  ASSERT_EQ(OB_SUCCESS, join_op_.drain_right_group());
+  EXPECT_EQ(0, right_op_.remain_rows_);
+  EXPECT_EQ(10, right_op_.read_rows_);
+  // 4 + 4 + 2 rows and the end batch
+  EXPECT_EQ(4, right_op_.read_times_);
+  EXPECT_TRUE(right_op_.get_brs().end_);
+
+  // the right batch has reached the end, nothing is read
+  right_op_.read_times_ = 0;
+  ASSERT_EQ(OB_SUCCESS, join_op_.drain_right_group());
+  EXPECT_EQ(0, right_op_.read_times_);
+
+  right_op_.brs_.end_ = false;
+  right_op_.remain_rows_ = 3;
+  right_op_.fail_ret_ = OB_ERR_UNEXPECTED;
+  EXPECT_EQ(OB_ERR_UNEXPECTED, join_op_.drain_right_group());
+  EXPECT_EQ(3, right_op_.remain_rows_);
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
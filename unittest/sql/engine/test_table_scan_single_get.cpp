@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#include "sql/engine/ob_exec_context.h"
+#include "lib/allocator/page_arena.h"
+#define private public
+#define protected public
+#include "sql/engine/table/ob_table_scan_op.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+// A point get on the full rowkey of one tablet ends right after its only row, without
+// asking the DAS result for the next row.
+class TestTableScanSingleGet : public ::testing::Test
+{
+public:
+  TestTableScanSingleGet()
+    : alloc_(ObModIds::TEST),
+      exec_ctx_(alloc_),
+      spec_(alloc_, PHY_TABLE_SCAN),
+      input_(exec_ctx_, spec_),
+      op_(exec_ctx_, spec_, &input_)
+  {
+  }
+
+  virtual void SetUp() override
+  {
+    spec_.tsc_ctdef_.scan_ctdef_.is_get_ = true;
+    spec_.batch_scan_flag_ = false;
+    spec_.is_vt_mapping_ = false;
+    ASSERT_EQ(OB_SUCCESS, input_.key_ranges_.push_back(ObNewRange()));
+    ASSERT_EQ(OB_SUCCESS, add_das_task());
+  }
+
+  virtual void TearDown() override
+  {
+    // the das tasks are fake ones, never touch them
+    op_.das_ref_.batched_tasks_.destroy();
+  }
+
+  int add_das_task()
+  {
+    return op_.das_ref_.batched_tasks_.store_obj(reinterpret_cast<ObIDASTaskOp *>(&fake_task_));
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  ObExecContext exec_ctx_;
+  ObTableScanSpec spec_;
+  ObTableScanOpInput input_;
+  ObTableScanOp op_;
+  int64_t fake_task_;
+};
+
+TEST_F(TestTableScanSingleGet, is_single_row_get)
+{
+  EXPECT_TRUE(op_.is_single_row_get());
+
+  spec_.tsc_ctdef_.scan_ctdef_.is_get_ = false;
+  EXPECT_FALSE(op_.is_single_row_get());
+  spec_.tsc_ctdef_.scan_ctdef_.is_get_ = true;
+
+  // group rescan of nested loop join gets several rows
+  spec_.batch_scan_flag_ = true;
+  EXPECT_FALSE(op_.is_single_row_get());
+  spec_.batch_scan_flag_ = false;
+
+  spec_.is_vt_mapping_ = true;
+  EXPECT_FALSE(op_.is_single_row_get());
+  spec_.is_vt_mapping_ = false;
+  EXPECT_TRUE(op_.is_single_row_get());
+
+  // multi get
+  ASSERT_EQ(OB_SUCCESS, input_.key_ranges_.push_back(ObNewRange()));
+  EXPECT_FALSE(op_.is_single_row_get());
+  input_.key_ranges_.pop_back();
+  EXPECT_TRUE(op_.is_single_row_get());
+
+  // get on several tablets
+  ASSERT_EQ(OB_SUCCESS, add_das_task());
+  EXPECT_FALSE(op_.is_single_row_get());
+}
+
+TEST_F(TestTableScanSingleGet, iter_end_after_the_row)
+{
+  // the row of the get has been produced
+  op_.input_row_cnt_ = 1;
+  EXPECT_EQ(OB_ITER_END, op_.get_next_row_with_das());
+  int64_t count = -1;
+  EXPECT_EQ(OB_ITER_END, op_.get_next_batch_with_das(count, 16));
+  EXPECT_EQ(0, count);
+  // nothing is read from the das result
+  EXPECT_EQ(1, op_.input_row_cnt_);
+  EXPECT_EQ(0, op_.output_row_cnt_);
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "sql/plan_cache/ob_lib_cache_node_qsync.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace sql;
+
+namespace unittest
+{
+// a cache node is retired the way ObPlanCache::retire_cache_node() does, and freed by
+// reclaim_retired_nodes() after node qsync
+struct TestNode
+{
+  TestNode() : freed_(false), next_(NULL) {}
+  bool freed_;
+  TestNode *next_;
+};
+
+class TestLCNodeQSync : public ::testing::Test
+{
+public:
+  static const int64_t READER_CNT = 8;
+  static const int64_t ROUND_CNT = 2000;
+  // nodes retired between two reclaims
+  static const int64_t RETIRE_BATCH = 10;
+
+  TestLCNodeQSync() : cur_node_(NULL), retired_nodes_(NULL), stop_(false), bad_read_cnt_(0) {}
+  void reader_loop()
+  {
+    while (!ATOMIC_LOAD(&stop_)) {
+      // stay in the critical section back to back, the slot of this thread never drops to 0
+      ObLCNodeCriticalGuard guard(qsync_);
+      TestNode *node = ATOMIC_LOAD(&cur_node_);
+      for (int64_t i = 0; i < 100; ++i) {
+        if (ATOMIC_LOAD(&node->freed_)) {
+          ATOMIC_INC(&bad_read_cnt_);
+        }
+      }
+    }
+  }
+  void retire(TestNode *node)
+  {
+    node->next_ = retired_nodes_;
+    retired_nodes_ = node;
+  }
+  int64_t reclaim()
+  {
+    int64_t free_cnt = 0;
+    TestNode *node = retired_nodes_;
+    retired_nodes_ = NULL;
+    qsync_.sync();
+    while (NULL != node) {
+      ATOMIC_STORE(&node->freed_, true);
+      node = node->next_;
+      ++free_cnt;
+    }
+    return free_cnt;
+  }
+protected:
+  ObLCNodeQSync qsync_;
+  TestNode *cur_node_;
+  TestNode *retired_nodes_;
+  bool stop_;
+  int64_t bad_read_cnt_;
+};
+
+TEST_F(TestLCNodeQSync, reclaim_with_active_readers)
+{
+  // nodes are kept until the end of the test, a freed node is only marked
+  std::vector<TestNode> nodes(ROUND_CNT + 1);
+  cur_node_ = &nodes[0];
+  std::vector<std::thread> readers;
+  for (int64_t i = 0; i < READER_CNT; ++i) {
+    readers.push_back(std::thread(&TestLCNodeQSync::reader_loop, this));
+  }
+  int64_t free_cnt = 0;
+  int64_t max_wait_time = 0;
+  for (int64_t i = 1; i <= ROUND_CNT; ++i) {
+    TestNode *old_node = ATOMIC_TAS(&cur_node_, &nodes[i]);
+    retire(old_node);
+    if (0 == i % RETIRE_BATCH) {
+      const int64_t start_ts = ObTimeUtility::current_time();
+      free_cnt += reclaim();
+      max_wait_time = std::max(max_wait_time, ObTimeUtility::current_time() - start_ts);
+    }
+  }
+  ATOMIC_STORE(&stop_, true);
+  for (int64_t i = 0; i < READER_CNT; ++i) {
+    readers[i].join();
+  }
+  LOG_INFO("reclaim with active readers", K(free_cnt), K(max_wait_time));
+  // every retired node is freed while the readers keep running, and none is read after free
+  ASSERT_TRUE(ROUND_CNT == free_cnt);
+  ASSERT_TRUE(NULL == retired_nodes_);
+  ASSERT_EQ(0, bad_read_cnt_);
+  ASSERT_FALSE(nodes[ROUND_CNT].freed_);
+}
+
+TEST_F(TestLCNodeQSync, wait_for_early_reader)
+{
+  bool synced = false;
+  std::thread syncer;
+  {
+    ObLCNodeCriticalGuard guard(qsync_);
+    syncer = std::thread([&]() {
+      qsync_.sync();
+      ATOMIC_STORE(&synced, true);
+    });
+    ::usleep(100 * 1000);
+    // the reader entered before sync() holds it
+    EXPECT_FALSE(ATOMIC_LOAD(&synced));
+    // a reader entering after sync() doesn't
+    std::thread late_reader([&]() {
+      ObLCNodeCriticalGuard late_guard(qsync_);
+      ::usleep(100 * 1000);
+    });
+    late_reader.join();
+    EXPECT_FALSE(ATOMIC_LOAD(&synced));
+  }
+  syncer.join();
+  ASSERT_TRUE(synced);
+  // nothing to wait for
+  qsync_.sync();
+  qsync_.sync();
+}
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_lib_cache_node_qsync.log*");
+  OB_LOGGER.set_file_name("test_lib_cache_node_qsync.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
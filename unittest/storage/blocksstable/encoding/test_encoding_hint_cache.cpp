@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "storage/blocksstable/encoding/ob_encoding_hint_cache.h"
+#undef private
+#include "lib/container/ob_array.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+using namespace common;
+
+class TestEncodingHintCache : public ::testing::Test
+{
+public:
+  typedef ObEncodingHintCache::EncodingArray EncodingArray;
+  void make_encodings(const int64_t column_cnt, const ObColumnHeader::Type type,
+                      ObArray<EncodingArray> &encodings)
+  {
+    encodings.reuse();
+    for (int64_t i = 0; i < column_cnt; ++i) {
+      EncodingArray array;
+      ASSERT_EQ(OB_SUCCESS, array.put(ObPreviousEncoding(type, i)));
+      ASSERT_EQ(OB_SUCCESS, encodings.push_back(array));
+    }
+  }
+};
+
+TEST_F(TestEncodingHintCache, get_and_put)
+{
+  ObEncodingHintCache cache;
+  const ObTabletID tablet_id(200001);
+  ObArray<EncodingArray> encodings;
+  ObArray<EncodingArray> result;
+  make_encodings(3, ObColumnHeader::DICT, encodings);
+
+  ASSERT_EQ(OB_NOT_INIT, cache.put(tablet_id, 1, encodings));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache.init(OB_INVALID_TENANT_ID));
+  ASSERT_EQ(OB_SUCCESS, cache.init(1001));
+  ASSERT_EQ(OB_INIT_TWICE, cache.init(1001));
+
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(tablet_id, 1, 3, result));
+  ASSERT_EQ(OB_SUCCESS, cache.put(tablet_id, 1, encodings));
+  ASSERT_EQ(OB_SUCCESS, cache.get(tablet_id, 1, 3, result));
+  ASSERT_EQ(3, result.count());
+  for (int64_t i = 0; i < 3; ++i) {
+    ASSERT_EQ(ObPreviousEncoding(ObColumnHeader::DICT, i), result.at(i).prev_encodings_[0]);
+  }
+  // schema changed or column count mismatch falls back to full detection
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(tablet_id, 2, 3, result));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(tablet_id, 1, 4, result));
+
+  // a put with another column count replaces the hint
+  make_encodings(5, ObColumnHeader::RAW, encodings);
+  ASSERT_EQ(OB_SUCCESS, cache.put(tablet_id, 2, encodings));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(tablet_id, 1, 3, result));
+  ASSERT_EQ(OB_SUCCESS, cache.get(tablet_id, 2, 5, result));
+  ASSERT_EQ(ObPreviousEncoding(ObColumnHeader::RAW, 4), result.at(4).prev_encodings_[0]);
+
+  cache.destroy();
+  ASSERT_EQ(nullptr, cache.get_slot(tablet_id).encodings_);
+  ASSERT_EQ(OB_NOT_INIT, cache.get(tablet_id, 2, 5, result));
+}
+
+TEST_F(TestEncodingHintCache, tenant_isolation)
+{
+  ObEncodingHintCache cache_a;
+  ObEncodingHintCache cache_b;
+  const ObTabletID tablet_id(200001);
+  ObArray<EncodingArray> encodings;
+  ObArray<EncodingArray> result;
+  ASSERT_EQ(OB_SUCCESS, cache_a.init(1001));
+  ASSERT_EQ(OB_SUCCESS, cache_b.init(1002));
+
+  // the same tablet id in another tenant neither sees nor evicts the hint
+  make_encodings(2, ObColumnHeader::DICT, encodings);
+  ASSERT_EQ(OB_SUCCESS, cache_a.put(tablet_id, 1, encodings));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_b.get(tablet_id, 1, 2, result));
+  make_encodings(2, ObColumnHeader::RAW, encodings);
+  ASSERT_EQ(OB_SUCCESS, cache_b.put(tablet_id, 1, encodings));
+  ASSERT_EQ(OB_SUCCESS, cache_a.get(tablet_id, 1, 2, result));
+  ASSERT_EQ(ObPreviousEncoding(ObColumnHeader::DICT, 0), result.at(0).prev_encodings_[0]);
+  ASSERT_EQ(1001, cache_a.tenant_id_);
+  ASSERT_EQ(1002, cache_b.tenant_id_);
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_encoding_hint_cache.log*");
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_encoding_hint_cache.log", true);
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -221,6 +221,112 @@ TEST_F(TestDictLargeVarchar, test_dict_large_varchar)
   ASSERT_TRUE(ObDatum::binary_equal(row.storage_datums_[3], read_row.storage_datums_[3]));
 }
 
+static ObObjType test_encoding_hint_col_types[3] = {ObIntType, ObVarcharType, ObVarcharType};
+class TestEncodingHint : public TestIColumnEncoder
+{
+public:
+  typedef ObPreviousEncodingArray<ObMicroBlockEncodingCtx::MAX_PREV_ENCODING_COUNT> EncodingArray;
+  static const int64_t ROW_CNT = 1000;
+  TestEncodingHint()
+  {
+    rowkey_cnt_ = 1;
+    column_cnt_ = 3;
+    col_types_ = reinterpret_cast<ObObjType *>(allocator_.alloc(sizeof(ObObjType) * column_cnt_));
+    for (int64_t i = 0; i < column_cnt_; ++i) {
+      col_types_[i] = test_encoding_hint_col_types[i];
+    }
+  }
+  virtual ~TestEncodingHint()
+  {
+    allocator_.free(col_types_);
+  }
+  // column 1 has 4 distinct values, column 2 is const or distinct
+  int build_block(ObMicroBlockEncoder &encoder, const int64_t start, const bool distinct_col2)
+  {
+    int ret = OB_SUCCESS;
+    ObDatumRow row;
+    char *buf = NULL;
+    int64_t size = 0;
+    if (OB_FAIL(row.init(allocator_, column_cnt_))) {
+      LOG_WARN("init row failed", K(ret));
+    }
+    for (int64_t i = start; OB_SUCC(ret) && i < start + ROW_CNT; ++i) {
+      char *col1 = static_cast<char *>(allocator_.alloc(16));
+      char *col2 = static_cast<char *>(allocator_.alloc(32));
+      const int64_t col1_len = snprintf(col1, 16, "value_%ld", i % 4);
+      const int64_t col2_len = distinct_col2 ? snprintf(col2, 32, "distinct_%ld", i * 7919)
+                                             : snprintf(col2, 32, "const_value");
+      row.storage_datums_[0].set_int(i);
+      row.storage_datums_[1].set_string(col1, col1_len);
+      row.storage_datums_[2].set_string(col2, col2_len);
+      if (OB_FAIL(encoder.append_row(row))) {
+        LOG_WARN("append row failed", K(ret), K(i));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(encoder.build_block(buf, size))) {
+      LOG_WARN("build block failed", K(ret));
+    } else {
+      encoder.reuse();
+    }
+    return ret;
+  }
+};
+
+TEST_F(TestEncodingHint, skip_detection_with_hint)
+{
+  ObArray<EncodingArray> hints;
+  {
+    ObMicroBlockEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    ASSERT_EQ(OB_SUCCESS, build_block(encoder, 0, false));
+    // nothing learned yet, every column is detected
+    ASSERT_EQ(column_cnt_, encoder.detect_column_cnt_);
+    ASSERT_EQ(OB_SUCCESS, hints.assign(encoder.get_previous_encodings()));
+    ASSERT_EQ(column_cnt_, hints.count());
+    // hints are only accepted before the first micro block
+    ASSERT_EQ(OB_INVALID_ARGUMENT, encoder.set_previous_encodings(hints));
+  }
+
+  ObMicroBlockEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  ObArray<EncodingArray> invalid_hints;
+  ASSERT_EQ(OB_SUCCESS, invalid_hints.push_back(hints.at(0)));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, encoder.set_previous_encodings(invalid_hints));
+  ASSERT_EQ(OB_SUCCESS, encoder.set_previous_encodings(hints));
+  // the hinted encodings are used since the first micro block, and the later ones rely on
+  // the encodings of the previous micro blocks till the periodic re-detection
+  const int64_t no_detect_block_cnt = 16 - ObMicroBlockEncoder::ENCODING_HINT_MICRO_BLOCK_CNT % 16;
+  for (int64_t i = 0; i < no_detect_block_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, build_block(encoder, i * ROW_CNT, false));
+    ASSERT_EQ(0, encoder.detect_column_cnt_);
+  }
+  ASSERT_EQ(OB_SUCCESS, build_block(encoder, no_detect_block_cnt * ROW_CNT, false));
+  ASSERT_LT(0, encoder.detect_column_cnt_);
+}
+
+TEST_F(TestEncodingHint, detect_if_hint_not_suitable)
+{
+  ObArray<EncodingArray> hints;
+  {
+    ObMicroBlockEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    ASSERT_EQ(OB_SUCCESS, build_block(encoder, 0, false));
+    ASSERT_EQ(OB_SUCCESS, hints.assign(encoder.get_previous_encodings()));
+  }
+  // column 2 is hinted as const but is distinct now, the hint is not suitable and only
+  // column 2 falls back to detection
+  hints.at(2).reuse();
+  ASSERT_EQ(OB_SUCCESS, hints.at(2).put(ObPreviousEncoding(ObColumnHeader::CONST, 0)));
+  ObMicroBlockEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  ASSERT_EQ(OB_SUCCESS, encoder.set_previous_encodings(hints));
+  ASSERT_EQ(OB_SUCCESS, build_block(encoder, 0, true));
+  ASSERT_EQ(1, encoder.detect_column_cnt_);
+  const EncodingArray &col2_encodings = encoder.get_previous_encodings().at(2);
+  ASSERT_NE(ObColumnHeader::CONST, col2_encodings.prev_encodings_[col2_encodings.last_pos_].type_);
+}
+
 class TestEncodingRowBufHolder : public ::testing::Test
 {
 public:
@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#define USING_LOG_PREFIX STORAGE
+
+#define protected public
+#define private public
+
+#include "storage/blocksstable/ob_data_file_prepare.h"
+#include "storage/blocksstable/ob_micro_block_cache.h"
+#include "share/ob_simple_mem_limit_getter.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace blocksstable;
+static ObSimpleMemLimitGetter getter;
+
+namespace unittest
+{
+class TestMicroBlockInflightIO : public TestDataFilePrepare
+{
+public:
+  static const int64_t MICRO_BLOCK_SIZE = 4096;
+  static const int64_t MICRO_BLOCK_CNT = 4;
+  static const int64_t THREAD_CNT = 16;
+  static const int64_t ROUND_CNT = 200;
+  typedef ObDataMicroBlockCache::ObInflightIOMap InflightIOMap;
+
+  TestMicroBlockInflightIO();
+  virtual ~TestMicroBlockInflightIO() = default;
+  virtual void SetUp() override;
+  virtual void TearDown() override;
+protected:
+  ObMicroBlockCacheKey get_key(const int64_t idx) const;
+  int64_t get_ref_cnt() const;
+  // read a micro block the way ObDataMicroBlockCache::prefetch and its waiter do
+  void read_micro_block(InflightIOMap &map, const int64_t idx);
+protected:
+  char *data_buf_;
+  ObMacroBlockHandle write_handle_;
+  MacroBlockId macro_id_;
+};
+
+TestMicroBlockInflightIO::TestMicroBlockInflightIO()
+  : TestDataFilePrepare(&getter, "TestMicroBlockInflightIO", OB_DEFAULT_MACRO_BLOCK_SIZE, 100),
+    data_buf_(nullptr),
+    write_handle_(),
+    macro_id_()
+{
+}
+
+void TestMicroBlockInflightIO::SetUp()
+{
+  TestDataFilePrepare::SetUp();
+  data_buf_ = static_cast<char *>(allocator_.alloc(OB_DEFAULT_MACRO_BLOCK_SIZE));
+  ASSERT_TRUE(nullptr != data_buf_);
+  for (int64_t i = 0; i < OB_DEFAULT_MACRO_BLOCK_SIZE; ++i) {
+    data_buf_[i] = static_cast<char>(i / MICRO_BLOCK_SIZE + i % 251);
+  }
+  ObMacroBlockWriteInfo write_info;
+  write_info.io_desc_.set_category(ObIOCategory::SYS_IO);
+  write_info.io_desc_.set_wait_event(ObWaitEventIds::DB_FILE_COMPACT_WRITE);
+  write_info.buffer_ = data_buf_;
+  write_info.size_ = OB_DEFAULT_MACRO_BLOCK_SIZE;
+  ASSERT_EQ(OB_SUCCESS, ObBlockManager::write_block(write_info, write_handle_));
+  macro_id_ = write_handle_.get_macro_id();
+  ASSERT_TRUE(macro_id_.is_valid());
+}
+
+void TestMicroBlockInflightIO::TearDown()
+{
+  write_handle_.reset();
+  TestDataFilePrepare::TearDown();
+}
+
+ObMicroBlockCacheKey TestMicroBlockInflightIO::get_key(const int64_t idx) const
+{
+  return ObMicroBlockCacheKey(OB_SERVER_TENANT_ID, macro_id_, idx * MICRO_BLOCK_SIZE, MICRO_BLOCK_SIZE);
+}
+
+int64_t TestMicroBlockInflightIO::get_ref_cnt() const
+{
+  ObBlockManager::BlockInfo block_info;
+  EXPECT_EQ(OB_SUCCESS, OB_SERVER_BLOCK_MGR.block_map_.get(macro_id_, block_info));
+  return block_info.mem_ref_cnt_;
+}
+
+void TestMicroBlockInflightIO::read_micro_block(InflightIOMap &map, const int64_t idx)
+{
+  const ObMicroBlockCacheKey key = get_key(idx);
+  ObMacroBlockHandle macro_handle;
+  int ret = map.get(key, macro_handle);
+  if (OB_ENTRY_NOT_EXIST == ret) {
+    ObMacroBlockReadInfo read_info;
+    read_info.macro_block_id_ = macro_id_;
+    read_info.offset_ = idx * MICRO_BLOCK_SIZE;
+    read_info.size_ = MICRO_BLOCK_SIZE;
+    read_info.io_desc_.set_category(ObIOCategory::USER_IO);
+    read_info.io_desc_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
+    ASSERT_EQ(OB_SUCCESS, ObBlockManager::async_read_block(read_info, macro_handle));
+    map.set(key, macro_handle);
+  } else {
+    ASSERT_EQ(OB_SUCCESS, ret);
+  }
+  ASSERT_EQ(OB_SUCCESS, macro_handle.wait(10 * 1000));
+  ASSERT_EQ(0, MEMCMP(data_buf_ + idx * MICRO_BLOCK_SIZE, macro_handle.get_buffer(), MICRO_BLOCK_SIZE));
+  map.erase_finished(key);
+}
+
+TEST_F(TestMicroBlockInflightIO, concurrent_miss)
+{
+  InflightIOMap map;
+  const int64_t base_ref_cnt = get_ref_cnt();
+  ObTenantBase *tenant_base = MTL_CTX();
+  std::thread threads[THREAD_CNT];
+  for (int64_t i = 0; i < THREAD_CNT; ++i) {
+    threads[i] = std::thread([&, i]() {
+      ObTenantEnv::set_tenant(tenant_base);
+      for (int64_t j = 0; j < ROUND_CNT; ++j) {
+        read_micro_block(map, (i + j) % MICRO_BLOCK_CNT);
+      }
+    });
+  }
+  for (int64_t i = 0; i < THREAD_CNT; ++i) {
+    threads[i].join();
+  }
+
+  // every shared io is released by its waiters, nothing pins the macro block any more
+  ObMacroBlockHandle macro_handle;
+  for (int64_t i = 0; i < MICRO_BLOCK_CNT; ++i) {
+    ASSERT_EQ(OB_ENTRY_NOT_EXIST, map.get(get_key(i), macro_handle));
+  }
+  ASSERT_EQ(base_ref_cnt, get_ref_cnt());
+}
+
+TEST_F(TestMicroBlockInflightIO, erase_and_clear)
+{
+  InflightIOMap map;
+  const int64_t base_ref_cnt = get_ref_cnt();
+  const ObMicroBlockCacheKey key = get_key(0);
+  ObMacroBlockReadInfo read_info;
+  read_info.macro_block_id_ = macro_id_;
+  read_info.offset_ = 0;
+  read_info.size_ = MICRO_BLOCK_SIZE;
+  read_info.io_desc_.set_category(ObIOCategory::USER_IO);
+  read_info.io_desc_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
+  ObMacroBlockHandle macro_handle;
+  ASSERT_EQ(OB_SUCCESS, ObBlockManager::async_read_block(read_info, macro_handle));
+  map.set(key, macro_handle);
+  ASSERT_EQ(base_ref_cnt + 2, get_ref_cnt());
+  ASSERT_EQ(OB_SUCCESS, macro_handle.wait(10 * 1000));
+
+  // entries of other keys or other tenants are kept
+  map.erase_finished(get_key(1));
+  map.clear(OB_SERVER_TENANT_ID + 1);
+  ASSERT_EQ(base_ref_cnt + 2, get_ref_cnt());
+  map.clear(OB_SERVER_TENANT_ID);
+  ASSERT_EQ(base_ref_cnt + 1, get_ref_cnt());
+
+  map.set(key, macro_handle);
+  ASSERT_EQ(base_ref_cnt + 2, get_ref_cnt());
+  map.erase_finished(key);
+  ASSERT_EQ(base_ref_cnt + 1, get_ref_cnt());
+  macro_handle.reset();
+  ASSERT_EQ(base_ref_cnt, get_ref_cnt());
+}
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_micro_block_inflight_io.log*");
+  OB_LOGGER.set_file_name("test_micro_block_inflight_io.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
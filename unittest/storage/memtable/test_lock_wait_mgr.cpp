@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "common/object/ob_object.h"
+#include "common/rowkey/ob_store_rowkey.h"
+#include "lib/function/ob_function.h"
+
+#define private public
+#include "storage/memtable/ob_lock_wait_mgr.h"
+#undef private
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace memtable;
+using namespace transaction;
+
+class TestLockWaitMgr : public ::testing::Test
+{
+public:
+  typedef ObLockWaitMgr::Node Node;
+  static const int64_t WAITER_CNT = ObLockWaitMgr::HOT_ROW_WAITER_THRESHOLD;
+
+  TestLockWaitMgr() : mgr_(NULL) {}
+  virtual void SetUp() override
+  {
+    mgr_ = new ObLockWaitMgr();
+  }
+  virtual void TearDown() override
+  {
+    ObLockWaitMgr::clear_thread_node();
+    delete mgr_;
+    mgr_ = NULL;
+  }
+  // the request of node conflicts on the row of rowkey
+  int post_row_conflict(Node &node, const int64_t rowkey, const bool is_remote_sql)
+  {
+    ObObj obj;
+    obj.set_int(rowkey);
+    ObStoreRowkey store_rowkey(&obj, 1);
+    ObFunction<int(bool&, bool&)> rechecker([&](bool &locked, bool &wait_on_row) -> int {
+      locked = true;
+      wait_on_row = true;
+      return OB_SUCCESS;
+    });
+    mgr_->setup(node, ObTimeUtility::current_time());
+    return mgr_->post_lock(OB_TRY_LOCK_ROW_CONFLICT, ObTabletID(200001), store_rowkey,
+        ObTimeUtility::current_time() + 10 * 1000 * 1000, is_remote_sql, true/*can_elr*/,
+        0, 0, ObTransID(1001), ObTransID(1000), rechecker);
+  }
+  // queue the request in lock wait mgr as ObLockWaitMgr::wait() does
+  int wait_on_row(Node &node, const int64_t rowkey)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_FAIL(post_row_conflict(node, rowkey, false))) {
+    } else if (0 != mgr_->hash_.insert(&node)) {
+      ret = OB_ERR_UNEXPECTED;
+    } else {
+      mgr_->add_row_waiter_cnt_(node.hash(), 1);
+    }
+    return ret;
+  }
+protected:
+  ObLockWaitMgr *mgr_;
+};
+
+TEST_F(TestLockWaitMgr, delay_header_node_of_cold_row)
+{
+  Node header;
+  Node remote;
+  ASSERT_EQ(OB_SUCCESS, wait_on_row(header, 1));
+  ASSERT_FALSE(mgr_->is_hot_row_(header.hash()));
+  ASSERT_EQ(0, header.get_run_ts());
+
+  const int64_t start_ts = ObTimeUtility::current_time();
+  ASSERT_EQ(OB_SUCCESS, post_row_conflict(remote, 1, true));
+  ASSERT_EQ(header.hash(), remote.hash());
+  ASSERT_LE(start_ts + ObLockWaitMgr::HEADER_NODE_DELAY_US, header.get_run_ts());
+  // the header node is not waked up before the remote request retries
+  ASSERT_TRUE(NULL == mgr_->fetch_waiter(header.hash()));
+}
+
+TEST_F(TestLockWaitMgr, delay_header_node_of_hot_row)
+{
+  Node waiters[WAITER_CNT];
+  Node remote;
+  for (int64_t i = 0; i < WAITER_CNT; i++) {
+    ASSERT_EQ(OB_SUCCESS, wait_on_row(waiters[i], 1));
+  }
+  Node *header = mgr_->hash_.get_next_internal(waiters[0].hash());
+  ASSERT_TRUE(NULL != header);
+  ASSERT_TRUE(mgr_->is_hot_row_(header->hash()));
+
+  // the remote request still gets its chance on the hot row, but shortly
+  int64_t start_ts = ObTimeUtility::current_time();
+  ASSERT_EQ(OB_SUCCESS, post_row_conflict(remote, 1, true));
+  const int64_t run_ts = header->get_run_ts();
+  ASSERT_LE(start_ts + ObLockWaitMgr::HOT_ROW_HEADER_NODE_DELAY_US, run_ts);
+  ASSERT_GT(start_ts + ObLockWaitMgr::HEADER_NODE_DELAY_US, run_ts);
+  ASSERT_TRUE(NULL == mgr_->fetch_waiter(header->hash()));
+
+  // the following remote requests don't postpone the header node again
+  for (int64_t i = 0; i < 10; i++) {
+    Node other_remote;
+    ASSERT_EQ(OB_SUCCESS, post_row_conflict(other_remote, 1, true));
+    ASSERT_EQ(run_ts, header->get_run_ts());
+  }
+
+  // and it is waked up once it is due, the row is not hot any more
+  ::usleep(ObLockWaitMgr::HOT_ROW_HEADER_NODE_DELAY_US);
+  ASSERT_EQ(header, mgr_->fetch_waiter(header->hash()));
+  ASSERT_FALSE(mgr_->is_hot_row_(header->hash()));
+
+  // the next header is delayed again by the next remote request
+  Node *next_header = mgr_->hash_.get_next_internal(waiters[0].hash());
+  ASSERT_TRUE(NULL != next_header);
+  ASSERT_EQ(0, next_header->get_run_ts());
+  ASSERT_EQ(OB_SUCCESS, post_row_conflict(remote, 1, true));
+  ASSERT_LT(0, next_header->get_run_ts());
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_lock_wait_mgr.log*");
+  OB_LOGGER.set_file_name("test_lock_wait_mgr.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
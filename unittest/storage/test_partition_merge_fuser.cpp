@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/compaction/ob_partition_merge_fuser.h"
+#include "storage/compaction/ob_partition_merge_iter.h"
+#include "lib/allocator/page_arena.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace storage;
+using namespace blocksstable;
+using namespace compaction;
+
+namespace unittest
+{
+const static int64_t COL_NUM = 3;
+
+// only the current row of the iter is used by the fuser
+class MockPartitionMergeIter : public ObPartitionMergeIter
+{
+public:
+  explicit MockPartitionMergeIter(const ObDatumRow &row) { curr_row_ = &row; }
+  virtual int next() override { return OB_ITER_END; }
+protected:
+  virtual bool inner_check(const ObMergeParameter &merge_param) override
+  {
+    UNUSED(merge_param);
+    return true;
+  }
+  virtual int inner_init(const ObMergeParameter &merge_param) override
+  {
+    UNUSED(merge_param);
+    return OB_SUCCESS;
+  }
+};
+
+class TestPartitionMergeFuser : public ::testing::Test
+{
+public:
+  TestPartitionMergeFuser() : allocator_(ObModIds::TEST) {}
+  virtual void SetUp() override
+  {
+    ASSERT_EQ(OB_SUCCESS, init_fuser(major_fuser_));
+    ASSERT_EQ(OB_SUCCESS, init_fuser(buf_fuser_));
+    ASSERT_EQ(OB_SUCCESS, insert_row_.init(allocator_, COL_NUM));
+    ASSERT_EQ(OB_SUCCESS, nop_row_.init(allocator_, COL_NUM));
+    for (int64_t i = 0; i < COL_NUM; i++) {
+      insert_row_.storage_datums_[i].set_int(i + 1);
+      nop_row_.storage_datums_[i].set_int(i + 10);
+    }
+    insert_row_.row_flag_.set_flag(ObDmlFlag::DF_INSERT);
+    // the last column is not updated
+    nop_row_.storage_datums_[COL_NUM - 1].set_nop();
+    nop_row_.row_flag_.set_flag(ObDmlFlag::DF_INSERT);
+  }
+
+  // init the fuser as ObMajorPartitionMergeFuser::inner_init does, with the default
+  // value 100 of every column
+  int init_fuser(ObMajorPartitionMergeFuser &fuser)
+  {
+    int ret = OB_SUCCESS;
+    fuser.column_cnt_ = COL_NUM;
+    if (OB_FAIL(fuser.result_row_.init(fuser.allocator_, COL_NUM))) {
+      STORAGE_LOG(WARN, "init result row failed", K(ret));
+    } else if (OB_FAIL(fuser.nop_pos_.init(fuser.allocator_, COL_NUM))) {
+      STORAGE_LOG(WARN, "init nop pos failed", K(ret));
+    } else if (OB_FAIL(fuser.default_row_.init(fuser.allocator_, COL_NUM))) {
+      STORAGE_LOG(WARN, "init default row failed", K(ret));
+    } else {
+      for (int64_t i = 0; i < COL_NUM; i++) {
+        fuser.default_row_.storage_datums_[i].set_int(100);
+      }
+      fuser.default_row_.row_flag_.set_flag(ObDmlFlag::DF_UPDATE);
+      fuser.is_inited_ = true;
+    }
+    return ret;
+  }
+
+  void check_row(const ObDatumRow &expect, const ObDatumRow &row)
+  {
+    ASSERT_EQ(expect.count_, row.count_);
+    EXPECT_TRUE(row.row_flag_.is_insert());
+    for (int64_t i = 0; i < expect.count_; i++) {
+      EXPECT_EQ(expect.storage_datums_[i].get_int(), row.storage_datums_[i].get_int()) << "col: " << i;
+    }
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+  ObMajorPartitionMergeFuser major_fuser_;
+  ObBufPartitionMergeFuser buf_fuser_;
+  ObDatumRow insert_row_;
+  ObDatumRow nop_row_;
+};
+
+TEST_F(TestPartitionMergeFuser, reuse_complete_row_of_one_iter)
+{
+  MockPartitionMergeIter iter(insert_row_);
+  MERGE_ITER_ARRAY iters;
+  ASSERT_EQ(OB_SUCCESS, iters.push_back(&iter));
+  ASSERT_EQ(OB_SUCCESS, major_fuser_.fuse_row(iters));
+  // the row of the iter is output directly
+  EXPECT_EQ(&insert_row_, major_fuser_.get_result_row());
+  check_row(insert_row_, *major_fuser_.get_result_row());
+
+  major_fuser_.reset();
+  EXPECT_TRUE(NULL == major_fuser_.reused_row_);
+}
+
+TEST_F(TestPartitionMergeFuser, fuse_row_with_nop)
+{
+  MockPartitionMergeIter insert_iter(insert_row_);
+  MockPartitionMergeIter nop_iter(nop_row_);
+  MERGE_ITER_ARRAY iters;
+  ASSERT_EQ(OB_SUCCESS, iters.push_back(&insert_iter));
+  ASSERT_EQ(OB_SUCCESS, major_fuser_.fuse_row(iters));
+  ASSERT_EQ(&insert_row_, major_fuser_.get_result_row());
+
+  // the reused row of the last fuse is not output any more
+  iters.reset();
+  ASSERT_EQ(OB_SUCCESS, iters.push_back(&nop_iter));
+  ASSERT_EQ(OB_SUCCESS, major_fuser_.fuse_row(iters));
+  ASSERT_EQ(&major_fuser_.result_row_, major_fuser_.get_result_row());
+  ObDatumRow expect;
+  ASSERT_EQ(OB_SUCCESS, expect.init(allocator_, COL_NUM));
+  expect.storage_datums_[0].set_int(10);
+  expect.storage_datums_[1].set_int(11);
+  expect.storage_datums_[2].set_int(100);
+  check_row(expect, *major_fuser_.get_result_row());
+}
+
+TEST_F(TestPartitionMergeFuser, fuse_rows_of_several_iters)
+{
+  MockPartitionMergeIter nop_iter(nop_row_);
+  MockPartitionMergeIter insert_iter(insert_row_);
+  MERGE_ITER_ARRAY iters;
+  ASSERT_EQ(OB_SUCCESS, iters.push_back(&nop_iter));
+  ASSERT_EQ(OB_SUCCESS, iters.push_back(&insert_iter));
+  ASSERT_EQ(OB_SUCCESS, major_fuser_.fuse_row(iters));
+  ASSERT_EQ(&major_fuser_.result_row_, major_fuser_.get_result_row());
+  ObDatumRow expect;
+  ASSERT_EQ(OB_SUCCESS, expect.init(allocator_, COL_NUM));
+  expect.storage_datums_[0].set_int(10);
+  expect.storage_datums_[1].set_int(11);
+  expect.storage_datums_[2].set_int(3);
+  check_row(expect, *major_fuser_.get_result_row());
+}
+
+TEST_F(TestPartitionMergeFuser, not_reuse_incomplete_row)
+{
+  MockPartitionMergeIter iter(insert_row_);
+  MERGE_ITER_ARRAY iters;
+  ASSERT_EQ(OB_SUCCESS, iters.push_back(&iter));
+
+  // multi version flag
+  insert_row_.set_last_multi_version_row();
+  ASSERT_EQ(OB_SUCCESS, major_fuser_.fuse_row(iters));
+  EXPECT_EQ(&major_fuser_.result_row_, major_fuser_.get_result_row());
+  check_row(insert_row_, *major_fuser_.get_result_row());
+  insert_row_.mvcc_row_flag_.reset();
+
+  // uncommitted row
+  insert_row_.trans_id_ = transaction::ObTransID(100);
+  ASSERT_EQ(OB_SUCCESS, major_fuser_.fuse_row(iters));
+  EXPECT_EQ(&major_fuser_.result_row_, major_fuser_.get_result_row());
+  insert_row_.trans_id_.reset();
+
+  // update row
+  insert_row_.row_flag_.set_flag(ObDmlFlag::DF_UPDATE);
+  ASSERT_EQ(OB_SUCCESS, major_fuser_.fuse_row(iters));
+  EXPECT_EQ(&major_fuser_.result_row_, major_fuser_.get_result_row());
+  // the fused row is output as an insert row
+  check_row(insert_row_, *major_fuser_.get_result_row());
+  insert_row_.row_flag_.set_flag(ObDmlFlag::DF_INSERT);
+
+  // the buf minor fuser never reuses the row of the iter
+  ASSERT_EQ(OB_SUCCESS, buf_fuser_.fuse_row(iters));
+  EXPECT_EQ(&buf_fuser_.result_row_, buf_fuser_.get_result_row());
+  check_row(insert_row_, *buf_fuser_.get_result_row());
+
+  // and the row is reused again once it's complete
+  ASSERT_EQ(OB_SUCCESS, major_fuser_.fuse_row(iters));
+  EXPECT_EQ(&insert_row_, major_fuser_.get_result_row());
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_partition_merge_fuser.log*");
+  OB_LOGGER.set_file_name("test_partition_merge_fuser.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
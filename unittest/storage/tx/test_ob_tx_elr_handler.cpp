@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define private public
+#include "storage/tx/ob_tx_elr_handler.h"
+#undef private
+#include "storage/tx/ob_trans_part_ctx.h"
+#include <gtest/gtest.h>
+#include "share/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+#include "storage/tx/ob_tx_data_define.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace transaction;
+using namespace storage;
+namespace unittest
+{
+
+class TestObTxELRHandler : public ::testing::Test
+{
+public :
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_F(TestObTxELRHandler, dep_state)
+{
+  EXPECT_EQ(TxELRDepState::ELR_DEP_COMMITTED, ObTxELRHandler::get_dep_state(ObTxData::COMMIT));
+  EXPECT_EQ(TxELRDepState::ELR_DEP_UNRESOLVED, ObTxELRHandler::get_dep_state(ObTxData::ELR_COMMIT));
+  EXPECT_EQ(TxELRDepState::ELR_DEP_ABORTED, ObTxELRHandler::get_dep_state(ObTxData::ABORT));
+  // the commit log of an elr txn failed and its state is reset to RUNNING
+  EXPECT_EQ(TxELRDepState::ELR_DEP_ABORTED, ObTxELRHandler::get_dep_state(ObTxData::RUNNING));
+}
+
+TEST_F(TestObTxELRHandler, add_dependency)
+{
+  ObTxELRHandler handler;
+  EXPECT_FALSE(handler.has_dependency());
+  handler.add_dependency(ObTransID(1));
+  handler.add_dependency(ObTransID(1));
+  EXPECT_TRUE(handler.has_dependency());
+  EXPECT_EQ(1, handler.dep_count_);
+  EXPECT_FALSE(handler.dep_overflow_);
+  handler.reset();
+  EXPECT_FALSE(handler.has_dependency());
+}
+
+TEST_F(TestObTxELRHandler, dependency_overflow)
+{
+  ObTxELRHandler handler;
+  ObPartTransCtx ctx;
+  for (int64_t i = 1; i <= ObTxELRHandler::MAX_ELR_DEPENDENCY_COUNT + 1; i++) {
+    handler.add_dependency(ObTransID(i));
+  }
+  EXPECT_EQ(ObTxELRHandler::MAX_ELR_DEPENDENCY_COUNT + 0, handler.dep_count_);
+  EXPECT_TRUE(handler.dep_overflow_);
+  TxELRDepState dep_state = TxELRDepState::ELR_DEP_COMMITTED;
+  EXPECT_EQ(OB_INVALID_ARGUMENT, handler.check_dependency(NULL, dep_state));
+  // the recorded dependencies are still checked in the tx table
+  EXPECT_EQ(OB_ERR_UNEXPECTED, handler.check_dependency(&ctx, dep_state));
+
+  // the dependencies not recorded can't be checked, the txn waits for them as
+  // unresolved instead of being aborted in cascade
+  handler.dep_count_ = 0;
+  EXPECT_EQ(OB_SUCCESS, handler.check_dependency(&ctx, dep_state));
+  EXPECT_EQ(TxELRDepState::ELR_DEP_UNRESOLVED, dep_state);
+  handler.reset();
+  EXPECT_FALSE(handler.dep_overflow_);
+  EXPECT_EQ(OB_SUCCESS, handler.check_dependency(&ctx, dep_state));
+  EXPECT_EQ(TxELRDepState::ELR_DEP_COMMITTED, dep_state);
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+
+int main(int argc, char **argv)
+{
+  int ret = 1;
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_tx_elr_handler.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  ret = RUN_ALL_TESTS();
+  return ret;
+}